@@ -8,12 +8,15 @@
 #include <stdexcept>
 #include <cstring>
 #include <vector>
+#include <numeric>
+#include <iterator>
+#include <type_traits>
+#include <cstdlib>
+#include <new>
+#include <cstddef>
 
 namespace
 {
-    // Buffer always reserves two "extra" spaces. This ensures that reserve and other relocating functions work correctly (the "never full" invariant).
-    constexpr size_t allocBuffer = 2;
-
     //Temporary object holder.
     template<typename Alloc>
     struct _alloc_temp
@@ -39,7 +42,7 @@ namespace
         }
 
         template<typename... Args>
-        explicit _alloc_temp(Alloc allocator, Args&&... args) noexcept(
+        explicit _alloc_temp(Alloc& allocator, Args&&... args) noexcept(
         noexcept(_traits::construct(_alloc, std::addressof(_getValue()), std::forward<Args>(args)...)))
         : _alloc(allocator)
         {
@@ -53,31 +56,324 @@ namespace
 
     };
 
-    
+    // Forward iterator that repeats a single value, so that a value can be inserted with the functions taking a source range.
+    template<typename T>
+    struct _repeat_iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const T* _value;
+        difference_type _index;
+
+        reference operator*() const noexcept { return *_value; }
+        pointer operator->() const noexcept { return _value; }
+
+        _repeat_iterator& operator++() noexcept
+        {
+            ++_index;
+            return *this;
+        }
+
+        _repeat_iterator operator++(int) noexcept
+        {
+            auto temp = *this;
+            ++_index;
+            return temp;
+        }
+
+        bool operator==(const _repeat_iterator& rhs) const noexcept { return _index == rhs._index; }
+        bool operator!=(const _repeat_iterator& rhs) const noexcept { return _index != rhs._index; }
+    };
+
+    // Strategies used to relocate elements to newly allocated memory.
+    struct _relocate_memcpy_tag {};
+    struct _relocate_move_tag {};
+    struct _relocate_copy_tag {};
+
+    template<typename Alloc, typename = void>
+    struct _has_custom_construct : std::false_type {};
+
+    template<typename Alloc>
+    struct _has_custom_construct<Alloc, decltype(void(std::declval<Alloc&>().construct(std::declval<typename Alloc::value_type*>(), std::declval<typename Alloc::value_type&&>())))> : std::true_type {};
+
+    template<typename Alloc, typename = void>
+    struct _has_custom_destroy : std::false_type {};
+
+    template<typename Alloc>
+    struct _has_custom_destroy<Alloc, decltype(void(std::declval<Alloc&>().destroy(std::declval<typename Alloc::value_type*>())))> : std::true_type {};
+
+    // Elements may be relocated bitwise only if the allocator does not customize construction or destruction. std::allocator only forwards to placement new and destructor.
+    template<typename Alloc>
+    struct _has_default_construct : std::integral_constant<bool, !_has_custom_construct<Alloc>::value && !_has_custom_destroy<Alloc>::value> {};
+
+    template<typename T>
+    struct _has_default_construct<std::allocator<T>> : std::true_type {};
+
+    template<typename Alloc, typename = void>
+    struct _has_reallocate : std::false_type {};
+
+    template<typename Alloc>
+    struct _has_reallocate<Alloc, decltype(void(std::declval<Alloc&>().reallocate(std::declval<typename Alloc::value_type*>(), size_t(), size_t())))> : std::true_type {};
 }
 
+/// @brief Trait telling if objects of type T can be relocated to a new address by copying their bytes, without calling the move constructor and destructor.
+/// @details True for trivially copyable types. Specialize as std::true_type for types that do not depend on their own address (for example most handle types and std::unique_ptr like wrappers).
+template<typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+/// @brief Default capacity policy. Capacity is used as requested and physical indices are wrapped with modulo arithmetic.
+struct default_capacity_policy
+{
+    /// @brief Rounds a requested capacity to a capacity supported by the policy.
+    /// @param capacity Requested capacity.
+    /// @return Capacity to allocate.
+    static size_t round(size_t capacity) noexcept
+    {
+        return capacity;
+    }
+
+    /// @brief Wraps an index to the physical memory area.
+    /// @param index Index to wrap. Must be less than 2 * capacity.
+    /// @param capacity Capacity of the buffer.
+    static size_t wrap(size_t index, size_t capacity) noexcept
+    {
+        return index >= capacity ? index - capacity : index;
+    }
+
+    /// @brief Gets the index following index, wrapping around at the end of physical memory area.
+    static size_t next(size_t index, size_t capacity) noexcept
+    {
+        ++index;
+        if(index >= capacity)
+        {
+            index = 0;
+        }
+        return index;
+    }
+
+    /// @brief Gets the index preceding index, wrapping around at the beginning of physical memory area.
+    static size_t prev(size_t index, size_t capacity) noexcept
+    {
+        if(index == 0)
+        {
+            return capacity - 1;
+        }
+        return index - 1;
+    }
+
+    /// @brief Gets the amount of steps from index first to index last.
+    static size_t distance(size_t first, size_t last, size_t capacity) noexcept
+    {
+        if(last < first)
+        {
+            return last + capacity - first;
+        }
+        return last - first;
+    }
+};
+
+/// @brief Power-of-two capacity policy. Capacity is always rounded up to a power of two, which allows wrapping indices with a bitmask instead of a division.
+struct pow2_capacity_policy
+{
+    /// @brief Rounds a requested capacity up to the next power of two.
+    /// @param capacity Requested capacity.
+    /// @return Capacity to allocate. If the rounded value would overflow, capacity is returned as is and the allocation is left to fail.
+    static size_t round(size_t capacity) noexcept
+    {
+        size_t rounded = 1;
+        while (rounded < capacity && rounded != 0)
+        {
+            rounded <<= 1;
+        }
+        return rounded ? rounded : capacity;
+    }
+
+    /// @brief Wraps an index to the physical memory area.
+    static size_t wrap(size_t index, size_t capacity) noexcept
+    {
+        return index & (capacity - 1);
+    }
+
+    /// @brief Gets the index following index. Branch-free.
+    static size_t next(size_t index, size_t capacity) noexcept
+    {
+        return (index + 1) & (capacity - 1);
+    }
+
+    /// @brief Gets the index preceding index. Branch-free.
+    static size_t prev(size_t index, size_t capacity) noexcept
+    {
+        return (index - 1) & (capacity - 1);
+    }
+
+    /// @brief Gets the amount of steps from index first to index last. Branch-free.
+    static size_t distance(size_t first, size_t last, size_t capacity) noexcept
+    {
+        return (last - first) & (capacity - 1);
+    }
+};
+
+/// @brief Default growth policy. Capacity grows by a factor of 1.5.
+struct default_growth_policy
+{
+    /// @brief Gets the capacity to allocate when the buffer runs out of memory.
+    /// @param capacity Current capacity of the buffer.
+    /// @param required Minimum capacity needed for the operation that triggered the growth.
+    /// @param elementSize Size of an element in bytes.
+    /// @return New capacity, at least required.
+    static size_t grow(size_t capacity, size_t required, size_t /*elementSize*/) noexcept
+    {
+        return std::max(capacity + capacity / 2, required);
+    }
+};
+
+/// @brief Doubling growth policy. Reallocates less often than the default policy at the cost of more unused memory.
+struct double_growth_policy
+{
+    static size_t grow(size_t capacity, size_t required, size_t /*elementSize*/) noexcept
+    {
+        return std::max(capacity * 2, required);
+    }
+};
+
+/// @brief Power-of-two growth policy. Capacity grows to the next power of two that fits the required capacity.
+/// @note Pairs with pow2_capacity_policy, which rounds every allocation to a power of two anyway.
+struct pow2_growth_policy
+{
+    static size_t grow(size_t capacity, size_t required, size_t /*elementSize*/) noexcept
+    {
+        return pow2_capacity_policy::round(std::max(capacity + 1, required));
+    }
+};
+
+/// @brief Page growth policy. Capacity grows by a factor of 1.5 and is then rounded up so that the allocation fills whole pages.
+/// @tparam PageSize Size of a memory page in bytes.
+template<size_t PageSize = 4096>
+struct page_growth_policy
+{
+    static size_t grow(size_t capacity, size_t required, size_t elementSize) noexcept
+    {
+        const auto grown = std::max(capacity + capacity / 2, required);
+        const auto bytes = (grown * elementSize + PageSize - 1) / PageSize * PageSize;
+        return bytes / elementSize;
+    }
+};
+
+/// @brief Default overflow policy. The buffer grows when an element is added to a full buffer, as decided by the GrowthPolicy.
+struct grow_overflow_policy {};
+
+/// @brief Overflow policy for a bounded buffer. Pushing to a full buffer replaces the element at the opposite end in constant time without allocating,
+/// so push_back overwrites the oldest element. Operations that would need to grow the buffer in the middle throw std::length_error.
+/// @note The bound is set with reserve(). A buffer with capacity() n holds n elements.
+struct overwrite_overflow_policy {};
+
+/// @brief Overflow policy for a bounded buffer. Adding elements to a full buffer throws std::length_error and leaves the buffer unchanged.
+/// try_push_back and try_emplace_back report a full buffer by returning false instead.
+/// @note The bound is set with reserve(). A buffer with capacity() n holds n elements.
+struct reject_overflow_policy {};
+
+/// @brief Allocator backed by malloc, realloc and free.
+/// @details Provides the optional reallocate extension. ring_buffer uses it to grow the buffer in place when elements are trivially relocatable.
+/// For large blocks realloc can grow into free address space after the block (mremap on Linux), so a multi gigabyte buffer does not need to be copied.
+/// @tparam T Type of the elements. Must not be over-aligned.
+template<typename T>
+struct realloc_allocator
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t), "realloc_allocator does not support over-aligned types.");
+
+    using value_type = T;
+
+    realloc_allocator() noexcept = default;
+
+    template<typename U>
+    realloc_allocator(const realloc_allocator<U>&) noexcept {}
+
+    T* allocate(size_t n)
+    {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        auto p = std::malloc(n * sizeof(T));
+        if (!p)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t) noexcept
+    {
+        std::free(p);
+    }
+
+    /// @brief Resizes a block, in place if possible. Contents are preserved bytewise.
+    /// @param p Pointer to a block from allocate or reallocate.
+    /// @param oldCapacity Amount of elements in the block.
+    /// @param newCapacity Requested amount of elements.
+    /// @return Pointer to the resized block, or null pointer if the block could not be resized. On failure p is left untouched.
+    T* reallocate(T* p, size_t /*oldCapacity*/, size_t newCapacity) noexcept
+    {
+        if (newCapacity > std::numeric_limits<size_t>::max() / sizeof(T))
+        {
+            return nullptr;
+        }
+        return static_cast<T*>(std::realloc(p, newCapacity * sizeof(T)));
+    }
+
+    friend bool operator==(const realloc_allocator&, const realloc_allocator&) noexcept { return true; }
+    friend bool operator!=(const realloc_allocator&, const realloc_allocator&) noexcept { return false; }
+};
+
+// Stores the allocator. Stateless allocators are stored as a base class, so that they take no space in the buffer (empty base optimization).
+    template<typename Alloc, bool = std::is_empty<Alloc>::value && !std::is_final<Alloc>::value>
+    struct _allocator_storage : private Alloc
+    {
+        explicit _allocator_storage(const Alloc& alloc) : Alloc(alloc) {}
+
+        Alloc& _allocator() noexcept { return *this; }
+        const Alloc& _allocator() const noexcept { return *this; }
+    };
+
+    template<typename Alloc>
+    struct _allocator_storage<Alloc, false>
+    {
+        explicit _allocator_storage(const Alloc& alloc) : m_allocator(alloc) {}
+
+        Alloc& _allocator() noexcept { return m_allocator; }
+        const Alloc& _allocator() const noexcept { return m_allocator; }
+
+        Alloc m_allocator;  /*!< Allocator used to allocate/deallocate and construct/destruct elements.*/
+    };
+
 //Base class that wraps memory allocation into an initialization (RAII).
-    template<typename T, typename Allocator = std::allocator<T>>
-    struct ring_buffer_base {
+    template<typename T, typename Allocator = std::allocator<T>, typename CapacityPolicy = default_capacity_policy>
+    struct ring_buffer_base : _allocator_storage<Allocator> {
 
         using size_type = std::size_t;
         using allocator_type = Allocator;
         using alloc_traits = std::allocator_traits<allocator_type>;
+        using storage = _allocator_storage<Allocator>;
 
         size_type m_capacity;  /*!< Capacity of the buffer. How many elements of type T the buffer has currently allocated memory for.*/
 
-        T* m_data;  /*!< Pointer to allocated memory.*/
-        Allocator m_allocator;  /*!< Allocator used to allocate/deallocate and construct/destruct elements. Default is std::allocator<T>*/
+        T* m_data;  /*!< Pointer to allocated memory. Null if the capacity is zero.*/
 
+        /// @note Capacity is rounded by the CapacityPolicy, so the allocated capacity may be larger than requested. A capacity of zero allocates nothing.
         ring_buffer_base(const Allocator& alloc, size_type capacity)
-            : m_allocator(alloc), m_data(alloc_traits::allocate(m_allocator, capacity)), m_capacity(capacity)
+            : storage(alloc), m_capacity(capacity == 0 ? 0 : CapacityPolicy::round(capacity)), m_data(m_capacity == 0 ? nullptr : alloc_traits::allocate(storage::_allocator(), m_capacity))
         {
         }
 
         ring_buffer_base(const ring_buffer_base&) = delete;
         ring_buffer_base& operator=(const ring_buffer_base&) = delete;
 
-        ring_buffer_base(ring_buffer_base&& other) noexcept : m_allocator(std::move(other.m_allocator)), m_data(std::exchange(other.m_data, nullptr)), m_capacity(std::exchange(other.m_capacity, 0))
+        ring_buffer_base(ring_buffer_base&& other) noexcept : storage(std::move(other._allocator())), m_capacity(std::exchange(other.m_capacity, 0)), m_data(std::exchange(other.m_data, nullptr))
         {
         }
 
@@ -87,31 +383,73 @@ namespace
             return *this;
         }
 
-        template<typename U>
-        void swap(ring_buffer_base<U>& left, ring_buffer_base<U>& right) noexcept
+        void swap(ring_buffer_base& left, ring_buffer_base& right) noexcept
         {
-            std::swap(left.m_allocator, right.m_allocator);    
+            std::swap(left._allocator(), right._allocator());
             std::swap(left.m_data, right.m_data);
             std::swap(left.m_capacity, right.m_capacity);
         }
 
-        ~ring_buffer_base() { alloc_traits::deallocate(m_allocator, m_data, m_capacity); }
+        ~ring_buffer_base()
+        {
+            if (m_data)
+            {
+                alloc_traits::deallocate(storage::_allocator(), m_data, m_capacity);
+            }
+        }
     };
 
+/// @brief Non-owning view to a contiguous memory segment of a ring_buffer.
+/// @tparam T Type of the elements, const qualified for read-only segments.
+template<typename T>
+class ring_buffer_span
+{
+public:
+    ring_buffer_span() noexcept : m_data(nullptr), m_size(0) {}
+
+    ring_buffer_span(T* data, size_t size) noexcept : m_data(data), m_size(size) {}
+
+    /// @brief Gets a pointer to the first element of the segment.
+    T* data() const noexcept { return m_data; }
+
+    /// @brief Gets the amount of elements in the segment.
+    size_t size() const noexcept { return m_size; }
+
+    /// @brief Checks if the segment is empty.
+    bool empty() const noexcept { return m_size == 0; }
+
+    T* begin() const noexcept { return m_data; }
+
+    T* end() const noexcept { return m_data + m_size; }
+
+private:
+    T* m_data;
+    size_t m_size;
+};
+
 // Forward declaration of _rBuf_const_iterator.
 template<class _rBuf>
 class _rBuf_const_iterator;
 
 /// @brief Dynamic Ringbuffer is a dynamically growing circular AllocatorAware std::container with support for queue, stack and priority queue adaptor functionality.
 /// @tparam T Type of the elements.
-/// @tparam Allocator Allocator used for (de)allocation and (de)construction. Defaults to std::allocator<T>
-template<typename T, typename Allocator = std::allocator<T>> 
-class ring_buffer : private ring_buffer_base<T,Allocator>
+/// @tparam Allocator Allocator used for (de)allocation and (de)construction. Defaults to std::allocator<T>. If the allocator provides
+/// T* reallocate(T* p, size_t oldCapacity, size_t newCapacity) that returns a null pointer instead of throwing on failure (see realloc_allocator)
+/// and T is trivially relocatable, the buffer grows in place.
+/// @tparam CapacityPolicy Policy that rounds capacity and wraps physical indices. Defaults to default_capacity_policy, pow2_capacity_policy enables mask based indexing.
+/// @tparam GrowthPolicy Policy that decides the new capacity when the buffer runs out of memory. Defaults to default_growth_policy (1.5x).
+/// @tparam OverflowPolicy Policy that decides what happens when the buffer is full. Defaults to grow_overflow_policy, overwrite_overflow_policy and
+/// reject_overflow_policy keep the buffer at the capacity set with reserve().
+template<typename T, typename Allocator = std::allocator<T>, typename CapacityPolicy = default_capacity_policy, typename GrowthPolicy = default_growth_policy, typename OverflowPolicy = grow_overflow_policy> 
+class ring_buffer : private ring_buffer_base<T,Allocator,CapacityPolicy>
 {
 
 public:
 
-    using base = typename ring_buffer<T,Allocator>::ring_buffer_base;
+    using base = typename ring_buffer::ring_buffer_base;
+    using capacity_policy = CapacityPolicy;
+    using growth_policy = GrowthPolicy;
+    using overflow_policy = OverflowPolicy;
 
     using size_type = typename base::size_type;
     using allocator_type = typename base::allocator_type;
@@ -126,6 +464,8 @@ public:
 
     /// @brief Custom iterator class.
     /// @tparam _rBuf ring_buffer class type.
+    /// @note The iterator holds a raw pointer to the element and the parent container. Dereferencing is a plain pointer access and
+    /// incrementing is a pointer bump with a check for the physical wrap boundary. The past-the-last iterator is represented by a null pointer.
     template<class _rBuf>
     class _rBuf_const_iterator
     {
@@ -139,26 +479,26 @@ public:
         using reference = const value_type&;
 
     public:
-        _rBuf_const_iterator() : m_container(nullptr), m_logicalIndex(0) {}
+        _rBuf_const_iterator() : m_container(nullptr), m_ptr(nullptr) {}
 
         /// @brief Constructor.
         /// @param index Index representing the logical element of the buffer where iterator points to.
-        explicit _rBuf_const_iterator(const _rBuf* container, difference_type index) : m_container(container), m_logicalIndex(index) {}
+        explicit _rBuf_const_iterator(const _rBuf* container, difference_type index) : m_container(container), m_ptr(container->_pointerAt(index)) {}
 
         /// @brief Arrow operator.
         /// @return pointer.
         /// @details Constant complexity.
         pointer operator->() const
         {
-            return &(*m_container)[m_logicalIndex];
+            return m_ptr;
         }
 
-        /// @brief Postfix increment
+        /// @brief Prefix increment
         /// @note If the iterator is incremented over the end() iterator leads to invalid iterator (dereferencing is undefined behaviour).
         /// @details Constant complexity.
         _rBuf_const_iterator& operator++() noexcept
         {
-            m_logicalIndex++;
+            m_ptr = m_container->_next(m_ptr);
 
             return (*this);
         }
@@ -170,7 +510,7 @@ public:
         _rBuf_const_iterator operator++(int)
         {
             auto temp(*this);
-            ++m_logicalIndex;
+            m_ptr = m_container->_next(m_ptr);
 
             return temp;
         }
@@ -180,7 +520,7 @@ public:
         /// @details Constant complexity.
         _rBuf_const_iterator& operator--()
         {
-            --m_logicalIndex;
+            m_ptr = m_container->_prev(m_ptr);
             return(*this);
         }
 
@@ -191,7 +531,7 @@ public:
         _rBuf_const_iterator operator--(int)
         {
             auto temp(*this);
-            --m_logicalIndex;
+            m_ptr = m_container->_prev(m_ptr);
             return temp;
         }
 
@@ -201,14 +541,7 @@ public:
         /// @details Constant complexity.
         _rBuf_const_iterator& operator+=(difference_type offset) noexcept
         {
-            if (offset < 0)
-            {
-                m_logicalIndex -= abs(offset);
-            }
-            else
-            {
-                m_logicalIndex += offset;
-            }
+            m_ptr = m_container->_pointerAt(getIndex() + offset);
             return (*this);
         }
 
@@ -218,7 +551,7 @@ public:
         /// @details Constant complexity.
         _rBuf_const_iterator operator+(const difference_type offset) const
         {
-            _rBuf_const_iterator temp(m_container, m_logicalIndex);
+            _rBuf_const_iterator temp(*this);
             return (temp += offset);
         }
 
@@ -250,7 +583,7 @@ public:
         /// @details Constant complexity.
         _rBuf_const_iterator operator-(const difference_type offset) const
         {
-            _rBuf_const_iterator temp(m_container, m_logicalIndex);
+            _rBuf_const_iterator temp(*this);
             return (temp -= offset);
         }
 
@@ -260,7 +593,7 @@ public:
         /// @details Constant complexity.
         difference_type operator-(const _rBuf_const_iterator& other) const noexcept
         {
-            return (m_logicalIndex - other.m_logicalIndex);
+            return (getIndex() - other.getIndex());
         }
 
         /// @brief Index operator.
@@ -270,7 +603,7 @@ public:
         /// @details Constant complexity.
         reference operator[](const difference_type offset) const noexcept
         {
-            return m_container->operator[](m_logicalIndex + offset);
+            return m_container->operator[](getIndex() + offset);
         }
 
         /// @brief Comparison operator== overload
@@ -279,7 +612,7 @@ public:
         /// @details Constant complexity.
         bool operator==(const _rBuf_const_iterator& other) const noexcept
         {
-            return (m_logicalIndex == other.m_logicalIndex) && (m_container == other.m_container);
+            return (m_ptr == other.m_ptr) && (m_container == other.m_container);
         }
 
         /// @brief Comparison operator != overload
@@ -288,7 +621,7 @@ public:
         /// @details Constant complexity.
         bool operator!=(const _rBuf_const_iterator& other) const noexcept
         {
-            return !(m_logicalIndex == other.m_logicalIndex && m_container == other.m_container);
+            return !(m_ptr == other.m_ptr && m_container == other.m_container);
         }
 
         /// @brief Comparison operator < overload
@@ -298,7 +631,7 @@ public:
         /// @details Constant complexity.
         bool operator<(const _rBuf_const_iterator& other) const noexcept
         {
-            return (m_logicalIndex < other.m_logicalIndex);
+            return (getIndex() < other.getIndex());
         }
 
         /// @brief Comparison operator > overload
@@ -308,7 +641,7 @@ public:
         /// @details Constant complexity.
         bool operator>(const _rBuf_const_iterator& other) const noexcept
         {
-            return (other.m_logicalIndex < m_logicalIndex);
+            return (other.getIndex() < getIndex());
         }
 
         /// @brief Less or equal operator.
@@ -318,7 +651,7 @@ public:
         /// @details Constant complexity.
         bool operator<=(const _rBuf_const_iterator& other) const noexcept
         {
-            return (!(other < m_logicalIndex));
+            return (!(other.getIndex() < getIndex()));
         }
 
         /// @brief Greater or equal than operator.
@@ -328,7 +661,7 @@ public:
         /// @details Constant complexity.
         bool operator>=(const _rBuf_const_iterator& other) const noexcept
         {
-            return (!(m_logicalIndex < other.m_logicalIndex));
+            return (!(getIndex() < other.getIndex()));
         }
 
         /// @brief Custom assingment operator overload.
@@ -336,7 +669,7 @@ public:
         /// @details Constant complexity.
         _rBuf_const_iterator& operator=(const size_t index) noexcept
         {
-            m_logicalIndex = index;
+            m_ptr = m_container->_pointerAt(index);
             return (*this);
         };
 
@@ -345,7 +678,7 @@ public:
         /// @details Constant complexity.
         reference operator*() const noexcept
         {
-            return (*m_container)[m_logicalIndex];
+            return *m_ptr;
 
         }
 
@@ -353,16 +686,29 @@ public:
         /// @details Constant complexity.
         difference_type getIndex() const noexcept
         {
-            return m_logicalIndex;
+            return m_container->_indexOf(m_ptr);
         }
 
+        /// @brief Splits the range [*this, last) into contiguous memory segments.
+        /// @param last Iterator past the last element of the range. Must be reachable from *this in the same container.
+        /// @return Pair of read-only segments in logical order. The second segment is empty unless the range wraps around the end of the allocated memory.
+        /// @details Constant complexity.
+        std::pair<ring_buffer_span<const value_type>, ring_buffer_span<const value_type>> getSegments(const _rBuf_const_iterator& last) const noexcept
+        {
+            const auto segs = m_container->_segments(m_ptr, last.m_ptr);
+            return {{segs.first.data(), segs.first.size()}, {segs.second.data(), segs.second.size()}};
+        }
+
+        // Marks the type as a ring_buffer iterator for the segment-aware algorithms.
+        using container_type = _rBuf;
+
     protected:
         // The parent container.
         const _rBuf* m_container;
 
-        // The iterator does not point to any memory location, but is interfaced to the Ring Buffer via an index which is the logical index
-        // to an element. Logical index 0 is the first element in the buffer and last is size - 1.
-        difference_type m_logicalIndex;
+        // Pointer to the element in physical memory. Logical index 0 is the first element in the buffer and last is size - 1,
+        // past-the-last element is represented by a null pointer since its physical address could equal to the first element.
+        typename _rBuf::pointer m_ptr;
     };
 
     /// @brief Custom iterator class.
@@ -396,7 +742,7 @@ public:
         /// @details Constant complexity.
         reference operator*() const noexcept
         {
-            return (*(const_cast<_rBuf*>(c_iterator::m_container)))[c_iterator::m_logicalIndex];
+            return *c_iterator::m_ptr;
         }
 
         /// @brief Arrow operator. 
@@ -404,7 +750,7 @@ public:
         /// @details Constant complexity.
         pointer operator->() const noexcept
         {
-            return const_cast<pointer>(c_iterator::operator->());
+            return c_iterator::m_ptr;
         }
 
         /// @brief Prefix increment.
@@ -412,7 +758,7 @@ public:
         /// @details Constant complexity.
         _rBuf_iterator& operator++() noexcept
         {
-            ++c_iterator::m_logicalIndex;
+            c_iterator::operator++();
             return (*this);
         }
 
@@ -423,7 +769,7 @@ public:
         _rBuf_iterator operator++(int)
         {
             auto temp(*this);
-            ++c_iterator::m_logicalIndex;
+            c_iterator::operator++();
             return temp;
         }
 
@@ -432,7 +778,7 @@ public:
         /// @note Decrementing the iterator past begin() leads to invalid iterator (dereferencing is undefined behaviour).
         _rBuf_iterator& operator--() noexcept
         {
-            --c_iterator::m_logicalIndex;
+            c_iterator::operator--();
             return(*this);
         }
 
@@ -443,7 +789,7 @@ public:
         _rBuf_iterator operator--(int)
         {
             auto temp(*this);
-            --c_iterator::m_logicalIndex;
+            c_iterator::operator--();
             return temp;
         }
 
@@ -453,14 +799,7 @@ public:
         /// @details Constant complexity.
         _rBuf_iterator& operator+=(difference_type offset) noexcept
         {
-            if (offset < 0)
-            {
-                c_iterator::m_logicalIndex -= abs(offset);
-            }
-            else
-            {
-                c_iterator::m_logicalIndex += offset;
-            }
+            c_iterator::operator+=(offset);
             return (*this);
         }
 
@@ -511,7 +850,7 @@ public:
         /// @details Constant complexity.
         difference_type operator-(const _rBuf_iterator& other) const noexcept
         {
-            return (c_iterator::m_logicalIndex - other.c_iterator::m_logicalIndex);
+            return (c_iterator::getIndex() - other.c_iterator::getIndex());
         }
 
         /// @brief Index operator.
@@ -521,7 +860,7 @@ public:
         /// @details Constant complexity.
         reference operator[](const difference_type offset) const noexcept
         {
-            return const_cast<reference>(c_iterator::m_container->operator[](offset));
+            return const_cast<reference>(c_iterator::operator[](offset));
         }
 
         /// @brief Comparison operator < overload.
@@ -530,7 +869,7 @@ public:
         /// @details Constant complexity.
         bool operator<(const _rBuf_iterator& other) const noexcept
         {
-            return (c_iterator::m_logicalIndex < other.c_iterator::m_logicalIndex);
+            return (c_iterator::getIndex() < other.c_iterator::getIndex());
         }
 
         /// @brief Comparison operator > overload.
@@ -539,7 +878,7 @@ public:
         /// @details Constant complexity.
         bool operator>(const _rBuf_iterator& other) const noexcept
         {
-            return (c_iterator::m_logicalIndex > other.c_iterator::m_logicalIndex);
+            return (c_iterator::getIndex() > other.c_iterator::getIndex());
         }
 
         /// @brief Comparison <= overload.
@@ -548,7 +887,7 @@ public:
         /// @details Constant complexity.
         bool operator<=(const _rBuf_iterator& other) const noexcept
         {
-            return (c_iterator::m_logicalIndex <= other.c_iterator::m_logicalIndex);
+            return (c_iterator::getIndex() <= other.c_iterator::getIndex());
         }
 
         /// @brief Comparison >= overload.
@@ -557,7 +896,7 @@ public:
         /// @details Constant complexity.
         bool operator>=(const _rBuf_iterator& other) const noexcept
         {
-            return (c_iterator::m_logicalIndex >= other.c_iterator::m_logicalIndex);
+            return (c_iterator::getIndex() >= other.c_iterator::getIndex());
         }
 
         /// @brief Custom assingment operator overload.
@@ -566,42 +905,50 @@ public:
         /// @details Constant complexity.
         _rBuf_iterator& operator=(const size_t index) noexcept
         {
-            c_iterator::m_logicalIndex = index;
+            c_iterator::operator=(index);
             return (*this);
         };
 
         /// @brief Index getter.
         /// @return Returns the index of the element this iterator is pointing to.
         /// @details Constant complexity.
-        difference_type getIndex() noexcept
+        difference_type getIndex() const noexcept
+        {
+            return c_iterator::getIndex();
+        }
+
+        /// @brief Splits the range [*this, last) into contiguous memory segments.
+        /// @param last Iterator past the last element of the range. Must be reachable from *this in the same container.
+        /// @return Pair of segments in logical order. The second segment is empty unless the range wraps around the end of the allocated memory.
+        /// @details Constant complexity.
+        std::pair<ring_buffer_span<value_type>, ring_buffer_span<value_type>> getSegments(const _rBuf_iterator& last) const noexcept
         {
-            return c_iterator::m_logicalIndex;
+            return c_iterator::m_container->_segments(c_iterator::m_ptr, last.m_ptr);
         }
     };
 
 
-    using iterator = _rBuf_iterator<ring_buffer<T>>;
-    using const_iterator = _rBuf_const_iterator<ring_buffer<T>>;
+    using iterator = _rBuf_iterator<ring_buffer>;
+    using const_iterator = _rBuf_const_iterator<ring_buffer>;
 
     using reverse_iterator = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-    /// @brief Default constructor.
-    /// @post this->empty() == true.
-    /// @throw Can throw std::bad_alloc if there is not enough memory available for allocation.
-    /// @exception If any exception is thrown the buffer will be in a valid but unexpected state. (Basic exception guarantee).
+    using span = ring_buffer_span<value_type>;
+    using const_span = ring_buffer_span<const value_type>;
+
+    /// @brief Default constructor. No memory is allocated until the first element is added.
+    /// @post this->empty() == true and capacity() == 0.
     /// @details Constant complexity.
-    ring_buffer() : ring_buffer(allocator_type())
+    ring_buffer() noexcept(noexcept(allocator_type())) : ring_buffer(allocator_type())
     {
     }
 
-    /// @brief Constructs the container with a custom allocator.
+    /// @brief Constructs the container with a custom allocator. No memory is allocated until the first element is added.
     /// @param alloc Custom allocator for the buffer.
-    /// @post this->empty() == true.
-    /// @throw Can throw std::bad_alloc if there is not enough memory available for allocation, or some exception from T's constructor.
-    /// @exception If any exception is thrown the buffer will be in a valid but unexpected state. (Basic exception guarantee).
+    /// @post this->empty() == true and capacity() == 0.
     /// @details Constant complexity.
-    explicit ring_buffer(const allocator_type& alloc) : base(alloc, allocBuffer), m_headIndex(0), m_tailIndex(0)
+    explicit ring_buffer(const allocator_type& alloc) noexcept : base(alloc, 0), m_size(0), m_tailIndex(0)
     {
     }
 
@@ -611,11 +958,11 @@ public:
     /// @param alloc Custom allocator.
     /// @pre T needs to satisfy CopyInsertable.
     /// @post std::distance(begin(), end()) == size().
-    /// @note Allocates memory for count + allocBuffer elements.
+    /// @note Allocates memory for exactly count elements, or nothing if count is zero.
     /// @throw Can throw std::bad_alloc if there is not enough memory available for allocation, or some exception from T's constructor.
     /// @exception If any exception is thrown the buffer will be in a valid but unexpected state. (Basic exception guarantee).
     /// @details Linear complexity in relation to amount of constructed elements (O(n)).
-    ring_buffer(size_type count, const_reference val, const allocator_type& alloc = allocator_type()) : base(alloc, count + allocBuffer), m_headIndex(count), m_tailIndex(0)
+    ring_buffer(size_type count, const_reference val, const allocator_type& alloc = allocator_type()) : base(alloc, count), m_size(count), m_tailIndex(0)
     {
         std::uninitialized_fill_n(base::m_data, count, val);
     }
@@ -626,7 +973,7 @@ public:
     /// @throw Can throw std::bad_alloc if there is not enough memory available for allocation, or some exception from T's constructor.
     /// @exception If any exception is thrown the buffer will be in a valid but unexpected state. (Basic exception guarantee).
     /// @details Linear complexity in relation to count (O(n)).
-    explicit ring_buffer(size_type count, const allocator_type& alloc = allocator_type()) : base(alloc, count + allocBuffer), m_headIndex(count), m_tailIndex(0)
+    explicit ring_buffer(size_type count, const allocator_type& alloc = allocator_type()) : base(alloc, count), m_size(count), m_tailIndex(0)
     {
         size_t first = 0;
         size_t current = 0;
@@ -635,7 +982,7 @@ public:
         {
             for (size_t i = 0; i < count; i++)
             {
-                alloc_traits::construct(base::m_allocator, base::m_data + current);
+                alloc_traits::construct(base::_allocator(), base::m_data + current);
                 current++;
             }
         }
@@ -643,10 +990,10 @@ public:
         {
             for (; first != current; first++)
             {
-                alloc_traits::destroy(base::m_allocator, base::m_data + first);
+                alloc_traits::destroy(base::_allocator(), base::m_data + first);
             }
             
-            m_headIndex = 0;
+            m_size = 0;
 
             throw;
         }
@@ -662,7 +1009,7 @@ public:
     /// @note Behavior is undefined if elements in range are not valid.
     template<typename InputIt,typename = std::enable_if_t<std::is_convertible<typename std::iterator_traits<InputIt>::value_type,value_type>::value>>
     ring_buffer(InputIt beginIt, InputIt endIt, const allocator_type& alloc = allocator_type())
-        : base(alloc, std::distance<InputIt>(beginIt,endIt) + allocBuffer), m_headIndex(std::distance<InputIt>(beginIt, endIt)), m_tailIndex(0)
+        : base(alloc, std::distance<InputIt>(beginIt,endIt)), m_size(std::distance<InputIt>(beginIt, endIt)), m_tailIndex(0)
     {
         std::uninitialized_copy(beginIt, endIt, base::m_data);
     }
@@ -685,7 +1032,7 @@ public:
     /// @except If any exception is thrown, invariants are preserved.(Basic Exception Guarantee).
     /// @details Linear complexity in relation to buffer size.
     ring_buffer(const ring_buffer& rhs) 
-    : m_headIndex(rhs.m_headIndex), m_tailIndex(rhs.m_tailIndex), base(alloc_traits::select_on_container_copy_construction(rhs.m_allocator), rhs.capacity())
+    : base(alloc_traits::select_on_container_copy_construction(rhs._allocator()), rhs.capacity()), m_size(rhs.size()), m_tailIndex(0)
     {
         std::uninitialized_copy(rhs.begin(), rhs.end(), base::m_data);
     }
@@ -698,7 +1045,7 @@ public:
     /// @throw Can throw std::bad_alloc, or something from T's CopyConstructor if not NoThrowCopyConstructible.
     /// @except If any exception is thrown, invariants are preserved.(Basic Exception Guarantee).
     /// @details Linear complexity in relation to buffer size.
-    ring_buffer(const ring_buffer& rhs, const allocator_type& alloc) : base(alloc, rhs.m_capacity), m_headIndex(rhs.m_headIndex), m_tailIndex(rhs.m_tailIndex)
+    ring_buffer(const ring_buffer& rhs, const allocator_type& alloc) : base(alloc, rhs.m_capacity), m_size(rhs.size()), m_tailIndex(0)
     {
         std::uninitialized_copy(rhs.begin(), rhs.end(), base::m_data);
     }
@@ -706,7 +1053,7 @@ public:
     /// @brief Move constructor.
     /// @param other Rvalue reference to other buffer.
     /// @details Constant complexity.
-    ring_buffer(ring_buffer&& other) noexcept : base(std::move(other)), m_headIndex(std::exchange(other.m_headIndex, 0)), m_tailIndex(std::exchange(other.m_tailIndex,0))
+    ring_buffer(ring_buffer&& other) noexcept : base(std::move(other)), m_size(std::exchange(other.m_size, 0)), m_tailIndex(std::exchange(other.m_tailIndex,0))
     {
     }
 
@@ -714,7 +1061,7 @@ public:
     /// @param other Rvalue reference to other buffer.
     /// @param alloc Allocator for the new ring buffer.
     /// @details Linear complexity in relation to buffer size.
-    ring_buffer(ring_buffer&& other, const allocator_type& alloc) : base(alloc, other.m_capacity), m_headIndex(other.m_headIndex), m_tailIndex(other.m_tailIndex)
+    ring_buffer(ring_buffer&& other, const allocator_type& alloc) : base(alloc, other.m_capacity), m_size(other.m_size), m_tailIndex(0)
     {
         size_t first = 0;
         size_t current = 0;
@@ -723,7 +1070,7 @@ public:
         {
             for (size_t i = 0; i < other.size(); i++)
             {
-                alloc_traits::construct(base::m_allocator, base::m_data + current, std::move(other[i]));
+                alloc_traits::construct(base::_allocator(), base::m_data + current, std::move(other[i]));
                 current++;
             }
         }
@@ -731,15 +1078,13 @@ public:
         {
             for (; first != current; first++)
             {
-                alloc_traits::destroy(base::m_allocator, base::m_data + first);
+                alloc_traits::destroy(base::_allocator(), base::m_data + first);
             }
-            m_headIndex = 0;
-            m_tailIndex = 0;
+            m_size = 0;
             throw;
         }
 
-        other.m_headIndex = 0;
-        other.m_tailIndex = 0;
+        other.clear();
     }
 
     /// Destructor.
@@ -797,13 +1142,13 @@ public:
     /// @return Returns an iterator to an element in the buffer which is copy of the first element in the range.
     /// @pre T must meet requirements of CopyInsertable. Iterators must point to elements that are implicitly convertible to value_type and sourceEnd must be reachable from sourceBegin. Otherwise behavior is undefined.
     /// @throw Can throw std::bad_alloc or something from value_types constructor and iterator operations. 
-    /// @exception If any exceptiong is thrown, the function does nothing (Strong exception guarantee).
-    /// @details Linear complexity in relation to buffer size and inserted elements. O(n).
+    /// @exception If memory is reallocated or the range is inserted at either end, the function does nothing if an exception is thrown (Strong exception guarantee).
+    /// Otherwise invariants are preserved (Basic exception guarantee).
+    /// @details Linear complexity in relation to inserted elements and the distance from pos to the closer end of the buffer, or to buffer size if memory is reallocated.
     template <typename InputIt>
     iterator insert(const_iterator pos, InputIt sourceBegin, InputIt sourceEnd)
     {
-        if(std::distance(sourceBegin, sourceEnd) == 0) return iterator(this, pos.getIndex() );
-        return insertRangeBase(pos, sourceBegin, sourceEnd);
+        return insertRangeBase(pos, sourceBegin, sourceEnd, typename std::iterator_traits<InputIt>::iterator_category());
     }
 
     /// @brief Inserts initializer list into buffer to a specific position.
@@ -816,8 +1161,7 @@ public:
     /// @details Linear complexity in relation to buffer size and inserted elements. O(n).
     iterator insert(const_iterator pos, std::initializer_list<T> list)
     {   
-        if (list.size() == 0) return iterator(this, pos.getIndex());
-        return insertRangeBase(pos, list.begin(), list.end());
+        return insertRangeBase(pos, list.begin(), list.end(), std::random_access_iterator_tag());
     }
 
     /// @brief Construct an element in place from arguments.
@@ -825,104 +1169,110 @@ public:
     /// @param args Argument pack containing arguments to construct value_type element.
     /// @return Returns an iterator pointing to the element constructed from args.
     /// @pre T must meet EmplaceConstructible, MoveAssignalbe and MoveInsertable.
-    /// @post Iterators, pointers and references are invalidated after the emplace point. If more memory is allocated, pointers and references to all elements are invalidated.
-    /// @throw Can throw std::bad_alloc if memory is allocated. Can also throw from T's constructor when constructing the element. Additionally, rotate can throw bad_alloc and if T does not provide a noexcept move semantics.
-    /// @exception If T's CopyConstructor is NoThrow then in case of any exception invariants are preserved. (Basic exception guarantee). If T's construction throws the behavior is undefined.
-    /// @details Amortized linear complexity in relation to distance from pos to end().
+    /// @post All iterators, pointers and references are invalidated.
+    /// @throw Can throw std::bad_alloc if memory is allocated. Can also throw from T's constructor when constructing the element, or from T's move constructor and move assignment.
+    /// @exception If T's construction throws the function has no effect. If moving throws, invariants are preserved (Basic exception guarantee).
+    /// @details Amortized linear complexity in relation to the distance from pos to the closer end of the buffer. The elements on that side are shifted to make room.
     template<class... Args>
     iterator emplace(const_iterator pos, Args&&... args)
     {
-        validateCapacity(1);
+        // Iterators hold addresses, so the position is saved as an index before memory may get reallocated.
+        const auto index = pos.getIndex();
 
-        iterator it(this, pos.getIndex());
-
-        //Construct temporary
-        _alloc_temp<Allocator> tempObj (base::m_allocator, std::forward<Args>(args)...);
-
-        //Provide basic guarantee. TODO provide strong guarantee to head and tail and optimize to move toward closer end.
-        auto last = end();
-        alloc_traits::construct(base::m_allocator, &*last, std::move(*(last - 1)));
-        increment(m_headIndex);
-        std::move_backward(it, last - 1 , last);
+        if (static_cast<size_type>(index) == size())
+        {
+            emplace_back(std::forward<Args>(args)...);
+            return iterator(this, index);
+        }
+        else if (index == 0)
+        {
+            emplace_front(std::forward<Args>(args)...);
+            return begin();
+        }
 
-        *it = std::move(tempObj._getValue());
+        // The element is constructed before reserving and shifting, because the arguments may refer to elements of the buffer.
+        _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<Args>(args)...);
+        validateCapacity(1);
+        _insertInPlace(index, 1, std::make_move_iterator(std::addressof(tempObj._getValue())));
 
-        return it;
+        return iterator(this, index);
     }
 
-    /// @brief Constructs an element in place to front from argumets.
+    /// @brief Constructs an element in place to front from argumets. If the buffer is full, the OverflowPolicy decides whether it grows, the last element is overwritten or std::length_error is thrown.
     /// @param args Argument pack containing arguments to construct value_type element.
     /// @pre value_type is EmplaceConstructible from args.
-    /// @throw Can throw std::bad_alloc if memory is allocated. Can also throw from T's constructor when constructing the element.
+    /// @throw Can throw std::bad_alloc if memory is allocated, or std::length_error if the buffer is full and rejects elements. Can also throw from T's constructor when constructing the element.
     /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
     /// @details  Amortized constant complexity.
     template<class... Args>
     void emplace_front(Args&&... args)
     {
-        if (base::m_capacity < size() + allocBuffer)
+        if (full())
         {
-            auto sz = size();
-
-            base temp(base::m_allocator, base::m_capacity * 3 / 2);
-            std::uninitialized_copy(begin(), end(), temp.m_data);
-            alloc_traits::construct(base::m_allocator, temp.m_data + temp.m_capacity - 1, std::forward<Args>(args)...);
-
-            destroy_elements();
-
-            base::swap(*this, temp);
-            m_headIndex = sz;
-            m_tailIndex = base::m_capacity - 1;
-
+            overflowFront(OverflowPolicy(), std::forward<Args>(args)...);
             return;
         }
 
         // Decrement temporary index in case constructor throws to retain invariants (elements of the buffer are always initialized).
         auto newIndex = m_tailIndex;
         decrement(newIndex);
-        alloc_traits::construct(base::m_allocator, base::m_data + newIndex, std::forward<Args>(args)...);
+        alloc_traits::construct(base::_allocator(), base::m_data + newIndex, std::forward<Args>(args)...);
         m_tailIndex = newIndex;
+        ++m_size;
     }
 
-    /// @brief Constructs an element in place to front from argumets.
+    /// @brief Constructs an element in place to back from argumets. If the buffer is full, the OverflowPolicy decides whether it grows, the first element is overwritten or std::length_error is thrown.
     /// @param args Argument pack containing arguments to construct value_type element.
     /// @pre value_type is EmplaceConstructible from args.
-    /// @throw Can throw std::bad_alloc if memory is allocated. Can also throw from T's constructor when constructing the element.
+    /// @throw Can throw std::bad_alloc if memory is allocated, or std::length_error if the buffer is full and rejects elements. Can also throw from T's constructor when constructing the element.
     /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
     /// @details Amortized constant complexity.
     template<class... Args>
     void emplace_back(Args&&... args)
     {
-        if (base::m_capacity < size() + allocBuffer)
+        if (full())
         {
-            auto sz = size();
-            base temp(base::m_allocator, base::m_capacity * 3 / 2);
-            std::uninitialized_copy(begin(), end(), temp.m_data);
+            overflowBack(OverflowPolicy(), std::forward<Args>(args)...);
+            return;
+        }
 
-            try
-            {
-                alloc_traits::construct(base::m_allocator, temp.m_data + sz, std::forward<Args>(args)...);
-            }
-            catch (...)
-            {
-                for (size_t i = 0; i < sz; ++i)
-                {
-                    alloc_traits::destroy(base::m_allocator, temp.m_data + i);
-                }
-                throw;
-            }
+        alloc_traits::construct(base::_allocator(), base::m_data + _headIndex(), std::forward<Args>(args)...);
+        ++m_size;
+    }
 
-            destroy_elements();
+    /// @brief Constructs an element in place to the back of the buffer if there is room for it without growing.
+    /// @param args Argument pack containing arguments to construct value_type element.
+    /// @return True if the element was added, false if the buffer is full.
+    /// @pre value_type is EmplaceConstructible from args.
+    /// @throw Can throw from T's constructor when constructing the element.
+    /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
+    /// @details Constant complexity. Never allocates, regardless of the OverflowPolicy.
+    template<class... Args>
+    bool try_emplace_back(Args&&... args)
+    {
+        if (full()) return false;
 
-            base::swap(*this, temp);
-            m_tailIndex = 0;
-            m_headIndex = sz;
-            increment(m_headIndex);
+        alloc_traits::construct(base::_allocator(), base::m_data + _headIndex(), std::forward<Args>(args)...);
+        ++m_size;
+        return true;
+    }
 
-            return;
-        }
+    /// @brief Copies an element to the back of the buffer if there is room for it without growing.
+    /// @param val Element to insert.
+    /// @return True if the element was added, false if the buffer is full.
+    /// @details Constant complexity.
+    bool try_push_back(const value_type& val)
+    {
+        return try_emplace_back(val);
+    }
 
-        alloc_traits::construct(base::m_allocator, base::m_data + m_headIndex, std::forward<Args>(args)...);
-        increment(m_headIndex);
+    /// @brief Moves an element to the back of the buffer if there is room for it without growing.
+    /// @param val Rvalue reference to the element to insert. Left untouched if the buffer is full.
+    /// @return True if the element was added, false if the buffer is full.
+    /// @details Constant complexity.
+    bool try_push_back(value_type&& val)
+    {
+        return try_emplace_back(std::move(val));
     }
 
     /// @brief Erase an element at a given position.
@@ -930,20 +1280,20 @@ public:
     /// @pre value_type must be nothrow-MoveConstructible. pos must be a valid dereferenceable iterator within the container. Otherwise behavior is undefined.
     /// @return Returns an iterator that was immediately following the ereased element. If the erased element was last in the buffer, returns a pointer to end().
     /// @exception If value_type is nothrow_move_constructible and nothrow_move_assignable function is noexcept. Otherwise provides no exception guarantee at all.
-    /// @details Linear Complexity in relation to distance of end buffer from the target element.
+    /// @details Linear Complexity in relation to distance of the nearer end of the buffer from the target element. Erasing the first or last element is constant.
     iterator erase(const_iterator pos)
     {
         return eraseBase(pos, pos + 1);
     }
 
-    /// @brief Erase the specified elements from the container according to the range [first,last). Might destroy or move assign to the elements depending if last == end(). If last == end(), elements in [first,last) are destroyed.
+    /// @brief Erase the specified elements from the container according to the range [first,last). Elements on the shorter side of the range are move assigned over it. If first == begin() or last == end(), elements in [first,last) are only destroyed.
     /// @param first iterator to the first element to erase.
     /// @param last iterator past the last element to erase.
     /// @pre First and last must be valid iterators to *this.
     /// @return Returns an iterator to the element that was immediately following the last erased elements. If last == end(), then new end() is returned.
-    /// @throw Possibly throws from value_types move/copy assignment operator if last != end().
+    /// @throw Possibly throws from value_types move/copy assignment operator if first != begin() and last != end().
     /// @exception If value_type is nothrow_move_constructible and nothrow_move_assignable function is noexcept. Otherwisde provides no exception guarantee at all.
-    /// @details Linear Complexity in relation to size of the range, and then linear in remaining elements after the erased range.
+    /// @details Linear Complexity in relation to size of the range, and then linear in the remaining elements on the shorter side of the erased range.
     iterator erase(const_iterator first, const_iterator last)
     {
         return eraseBase(first, last);
@@ -956,7 +1306,7 @@ public:
     {
         destroy_elements();
 
-        m_headIndex = 0;
+        m_size = 0;
         m_tailIndex = 0;
     }
 
@@ -972,12 +1322,13 @@ public:
     void assign(InputIt sourceBegin, InputIt sourceEnd)
     {
         size_type amount = std::distance(sourceBegin, sourceEnd);
-        if (base::m_capacity < amount + allocBuffer)
+        if (base::m_capacity < amount)
         {
-            base temp{base::m_allocator, amount * 3 / 2 };
+            base temp{base::_allocator(), grownCapacity(amount)};
             std::uninitialized_copy(sourceBegin, sourceEnd, temp.m_data);
+            destroy_elements();
             base::swap(*this, temp);
-            m_headIndex = amount;
+            m_size = amount;
             m_tailIndex = 0;
 
             return;
@@ -985,7 +1336,7 @@ public:
 
         clear();
         std::uninitialized_copy(sourceBegin, sourceEnd, base::m_data);
-        m_headIndex = amount;
+        m_size = amount;
     }
 
     /// @brief Replaces the elements in the buffer with copy of the initializer list.
@@ -1011,19 +1362,21 @@ public:
     void assign(const size_type amount, const value_type& value)
     {
 
-        if (base::m_capacity < amount + allocBuffer)
+        if (base::m_capacity < amount)
         {
-            base temp{base::m_allocator, amount * 3/2};
+            base temp{base::_allocator(), grownCapacity(amount)};
             std::uninitialized_fill_n(temp.m_data, amount, value);
+            destroy_elements();
             base::swap(*this, temp);
-            m_headIndex = amount;
-            
+            m_size = amount;
+            m_tailIndex = 0;
+
             return;
         }
         
         clear();
         std::uninitialized_fill_n(base::m_data, amount, value);
-        m_headIndex = amount;
+        m_size = amount;
     }
 
     /// @brief Copy assignment operator.
@@ -1038,17 +1391,20 @@ public:
 
         if (this == &other) return *this;
 
-        if (alloc_traits::propagate_on_container_copy_assignment::value && (base::m_allocator != other.m_allocator))
+        if (alloc_traits::propagate_on_container_copy_assignment::value && (base::_allocator() != other._allocator()))
         {
             auto temp = ring_buffer(other);
 
             base::swap(*this, temp);
             std::swap(m_tailIndex, temp.m_tailIndex);
-            std::swap(m_headIndex, temp.m_headIndex);
+            std::swap(m_size, temp.m_size);
         }
         else
         {
-            validateCapacity(other.size() - base::m_capacity);
+            if (other.size() > size())
+            {
+                validateCapacity(other.size() - size());
+            }
 
             auto targetSize = size();
             auto sourceSize = other.size();
@@ -1083,11 +1439,10 @@ public:
     /// @details Constant complexity.
     ring_buffer& operator=(ring_buffer&& other) noexcept
     {
-        if (!alloc_traits::propagate_on_container_move_assignment::value && base::m_allocator != other.m_allocator)
+        if (!alloc_traits::propagate_on_container_move_assignment::value && base::_allocator() != other._allocator())
         {
-            clear();
-
-            _uninitialized_move(other.begin(), other.end(), base::m_data);
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
         }
         else
         {
@@ -1118,7 +1473,7 @@ public:
     /// @return Returns a reference to the element.
     reference operator[](const size_type logicalIndex) noexcept
     {
-        return base::m_data[(m_tailIndex + logicalIndex) % base::m_capacity];
+        return base::m_data[CapacityPolicy::wrap(m_tailIndex + logicalIndex, base::m_capacity)];
     }
 
     /// @brief Index operator.
@@ -1128,7 +1483,7 @@ public:
     /// @return Returns a const reference the the element ad logicalIndex.
     const_reference operator[](const size_type logicalIndex) const noexcept
     {
-        return base::m_data[(m_tailIndex + logicalIndex) % base::m_capacity];
+        return base::m_data[CapacityPolicy::wrap(m_tailIndex + logicalIndex, base::m_capacity)];
     }
 
     /// @brief Get a specific element of the buffer with bounds checking.
@@ -1183,12 +1538,12 @@ public:
         using std::swap;
         if (alloc_traits::propagate_on_container_swap::value)
         {
-            swap(base::m_allocator, other.m_allocator);
+            swap(base::_allocator(), other._allocator());
         }
 
         swap(base::m_data, other.m_data);
         swap(base::m_capacity, other.m_capacity);
-        swap(m_headIndex, other.m_headIndex);
+        swap(m_size, other.m_size);
         swap(m_tailIndex, other.m_tailIndex);
     }
 
@@ -1213,32 +1568,51 @@ public:
     {
         if(!size())
         {
-            m_headIndex = 0;
             m_tailIndex = 0;
             return base::m_data;
         }
 
-        base temp = {base::m_allocator, base::m_capacity};
-        _uninitialized_move(begin(), end(), temp.m_data);
+        base temp = {base::_allocator(), base::m_capacity};
+        _relocate(temp.m_data);
         base::swap(*this, temp);
 
-        m_headIndex = size();
         m_tailIndex = 0;
 
         return base::m_data;
     }
 
+    /// @brief Gets the elements of the buffer as contiguous memory segments without moving them.
+    /// @return Pair of segments in logical order. The second segment is empty unless the elements wrap around the end of the allocated memory.
+    /// @note Unlike data(), does not allocate memory or move elements. Pointers are invalidated by the same operations as references.
+    /// @details Constant complexity.
+    std::pair<span, span> segments() noexcept
+    {
+        return _range(0, m_size);
+    }
+
+    /// @brief Gets the elements of the buffer as contiguous read-only memory segments without moving them.
+    /// @return Pair of segments in logical order. The second segment is empty unless the elements wrap around the end of the allocated memory.
+    /// @details Constant complexity.
+    std::pair<const_span, const_span> segments() const noexcept
+    {
+        auto segs = const_cast<ring_buffer*>(this)->segments();
+        return {const_span(segs.first.data(), segs.first.size()), const_span(segs.second.data(), segs.second.size())};
+    }
+
+    /// @brief Gets the unused memory of the buffer as contiguous segments of uninitialized memory.
+    /// @return Pair of segments in the order push_back would use them. The second segment is empty unless the free memory wraps around the end of the allocated memory.
+    /// @details Constant complexity.
+    std::pair<span, span> free_segments() noexcept
+    {
+        return _range(m_size, base::m_capacity - m_size);
+    }
+
     /// @brief Gets the size of the container.
     /// @return Size of buffer.
     /// @details Constant complexity.
     size_type size() const noexcept
     {
-        if(m_headIndex < m_tailIndex)
-        {
-            return m_headIndex + base::m_capacity - m_tailIndex;
-        }
-
-        return m_headIndex - m_tailIndex;
+        return m_size;
     }
 
     /// @brief Gets the theoretical maximum size of the container.
@@ -1263,7 +1637,7 @@ public:
     /// @details Constant complexity.
     allocator_type get_allocator() const noexcept
     {
-        return base::m_allocator;
+        return base::_allocator();
     }
 
     /// @brief Check if buffer is empty
@@ -1271,62 +1645,44 @@ public:
     /// @details Constant complexity.
     bool empty() const noexcept
     {
-        return m_tailIndex == m_headIndex;
+        return m_size == 0;
+    }
+
+    /// @brief Check if adding an element requires growing the buffer. A full buffer is handled by the OverflowPolicy.
+    /// @return True if buffer is full.
+    /// @details Constant complexity.
+    bool full() const noexcept
+    {
+        return m_size == base::m_capacity;
     }
 
     /// @brief Allocates memory and copies the existing buffer to the new memory location. Can be used to increase or decrease capacity.
     /// @throw Throws std::bad_alloc if there is not enough memory for allocation. Throws std::bad_array_new_lenght if std::numeric_limits<std::size_t>::max() / sizeof(T) < newsize.
     /// @param newCapacity Amount of memory to allocate. If newCapacity is less than or equal to m_capacity, function does nothing.
-    /// @param enableShrink True to enable reserve to reduce the capacity, to a minimum of size() +2.
+    /// @param enableShrink True to enable reserve to reduce the capacity, to a minimum of size().
     /// @pre T must meet MoveInsertable.
     /// @throw Can throw std::bad_alloc. 
-    /// @exception If T's move (or copy if T has no move) constructor throws, behaviour is undefined. Otherwise Stong Exception Guarantee.
+    /// @exception If T's move constructor throws and T is not CopyInsertable, the elements are left in a valid but unspecified state. Otherwise Stong Exception Guarantee.
+    /// @note Elements are relocated with memcpy if T is trivially relocatable, moved if T is nothrow move constructible and otherwise copied.
     /// @note All references, pointers and iterators are invalidated. If memory is allocated, the memory layout is rotated so that first element matches the beginning of physical memory.
+    /// If the buffer grows in place through the allocator's reallocate, only the shorter wrapped segment is moved and the layout is not rotated.
     /// @details Linear complexity in relation to size of the buffer (O(n)).
     void reserve(size_type newCapacity, bool enableShrink = false)
     {
         if (enableShrink)
         {
-            if (newCapacity < size() + allocBuffer) return;
+            if (newCapacity < size()) return;
         }
         else
         {
             if (newCapacity <= base::m_capacity) return;
+            if (tryReallocate(newCapacity)) return;
         }
 
-        base temp = {base::m_allocator, newCapacity};
+        base temp = {base::_allocator(), newCapacity};
+        _relocate(temp.m_data);
 
-        if (std::is_nothrow_move_constructible<value_type>::value)
-        {
-            size_type first = 0;
-            size_type current = 0;
-
-            try
-            {
-                for (size_t i = 0; i < size(); i++)
-                {
-                    alloc_traits::construct(base::m_allocator, temp.m_data + current, std::move(this->operator[](i)));
-                    current++;
-                }
-            }
-            catch (...)
-            {
-                for (; first != current; first++)
-                {
-                    alloc_traits::destroy(base::m_allocator, base::m_data + first);
-                }
-                m_headIndex = 0;
-                m_tailIndex = 0;
-                throw;
-            }
-        }
-        else
-        {
-            std::uninitialized_copy(begin(), end(), temp.m_data);
-        }
-        
-        m_headIndex = this->size();
-        m_tailIndex = 0;
+        m_tailIndex = 0;
 
         base::swap(*this, temp);
     }
@@ -1383,14 +1739,69 @@ public:
         emplace_back(std::move(val));
     }
 
+    /// @brief Inserts a range of elements to the back of the buffer.
+    /// @param sourceBegin Iterator to the first element of the range.
+    /// @param sourceEnd Iterator past the last element of the range.
+    /// @pre value_type must satisfy CopyInsertable. Elements of the range must not be in *this.
+    /// @post If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @throw Can throw std::bad_alloc or something from value_type's constructor.
+    /// @exception If any exception is thrown the elements of the buffer are not modified, but capacity may have grown (Strong exception guarantee for the elements). For input iterators Basic exception guarantee.
+    /// @details Linear complexity in relation to the size of the range. Capacity is checked once and the elements are constructed into at most two contiguous segments.
+    template<typename InputIt>
+    void append(InputIt sourceBegin, InputIt sourceEnd)
+    {
+        appendBase(sourceBegin, sourceEnd, typename std::iterator_traits<InputIt>::iterator_category());
+    }
+
+    /// @brief Inserts the elements of an initializer list to the back of the buffer.
+    /// @param list Elements to insert.
+    /// @details Linear complexity in relation to the size of the list.
+    void append(std::initializer_list<T> list)
+    {
+        append(list.begin(), list.end());
+    }
+
+    /// @brief Inserts a range of elements to the front of the buffer, keeping the order of the range. Same as insert(begin(), sourceBegin, sourceEnd) but without moving existing elements.
+    /// @param sourceBegin Iterator to the first element of the range.
+    /// @param sourceEnd Iterator past the last element of the range.
+    /// @pre value_type must satisfy CopyInsertable. ForwardIt must satisfy ForwardIterator. Elements of the range must not be in *this.
+    /// @post If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @throw Can throw std::bad_alloc or something from value_type's constructor.
+    /// @exception If any exception is thrown the elements of the buffer are not modified, but capacity may have grown (Strong exception guarantee for the elements).
+    /// @details Linear complexity in relation to the size of the range.
+    template<typename ForwardIt>
+    void prepend(ForwardIt sourceBegin, ForwardIt sourceEnd)
+    {
+        const size_type count = std::distance(sourceBegin, sourceEnd);
+        if (count == 0) return;
+
+        validateCapacity(count);
+
+        // Free slots before the tail, in logical order.
+        const auto segs = _range(base::m_capacity - count, count);
+        _constructSegments(segs, sourceBegin);
+
+        m_tailIndex = CapacityPolicy::wrap(m_tailIndex + base::m_capacity - count, base::m_capacity);
+        m_size += count;
+    }
+
+    /// @brief Inserts the elements of an initializer list to the front of the buffer, keeping the order of the list.
+    /// @param list Elements to insert.
+    /// @details Linear complexity in relation to the size of the list.
+    void prepend(std::initializer_list<T> list)
+    {
+        prepend(list.begin(), list.end());
+    }
+
     /// @brief Remove the first element in the buffer.
     /// @pre Buffers size > 0, otherwise behaviour is undefined.
     /// @post All iterators, pointers and references are invalidated.
     /// @details Constant complexity.
     void pop_front() noexcept
     {
-        alloc_traits::destroy(base::m_allocator, base::m_data + m_tailIndex);
+        alloc_traits::destroy(base::_allocator(), base::m_data + m_tailIndex);
         increment(m_tailIndex);
+        --m_size;
     }
 
     /// @brief Erase an element from the logical back of the buffer.
@@ -1399,21 +1810,82 @@ public:
     /// @details Constant complexity.
     void pop_back() noexcept
     {
-        decrement(m_headIndex);
-        alloc_traits::destroy(base::m_allocator, base::m_data + m_headIndex);
+        --m_size;
+        alloc_traits::destroy(base::_allocator(), base::m_data + _headIndex());
+    }
+
+    /// @brief Removes count elements from the front of the buffer.
+    /// @param count Amount of elements to remove.
+    /// @pre count <= size(), otherwise behaviour is undefined.
+    /// @post Pointers and references to the removed elements are invalidated.
+    /// @details Constant complexity for trivially destructible types, otherwise linear in count.
+    void pop_front_n(size_type count) noexcept
+    {
+        if (count == 0) return;
+
+        _destroySegments(_range(0, count));
+        increment(m_tailIndex, count);
+        m_size -= count;
+    }
+
+    /// @brief Removes count elements from the back of the buffer.
+    /// @param count Amount of elements to remove.
+    /// @pre count <= size(), otherwise behaviour is undefined.
+    /// @post Pointers and references to the removed elements are invalidated.
+    /// @details Constant complexity for trivially destructible types, otherwise linear in count.
+    void pop_back_n(size_type count) noexcept
+    {
+        if (count == 0) return;
 
+        _destroySegments(_range(size() - count, count));
+        m_size -= count;
     }
 
     /// @brief Releases unused allocated memory. 
     /// @pre T must satisfy MoveConstructible or CopyConstructible.
-    /// @post m_capacity == size() + allocBuffer.
-    /// @note Reduces capacity by allocating a smaller memory area and moving the elements. Shrinking the buffer invalidates all pointers, iterators and references.
+    /// @post capacity() == size().
+    /// @note Reduces capacity by allocating a smaller memory area and moving the elements. An empty buffer releases all of its memory. Shrinking the buffer invalidates all pointers, iterators and references.
     /// @throw Might throw std::bad_alloc if memory allocation fails.
     /// @exception If T's move (or copy) constructor can and does throw, behaviour is undefined. If any other exception is thrown (bad_alloc) this function has no effect (Strong exception guarantee).
     /// @details Linear complexity in relation to size of the buffer.
     void shrink_to_fit()
     {
-        reserve(size() + allocBuffer, true);
+        if (empty())
+        {
+            base temp(base::_allocator(), 0);
+            base::swap(*this, temp);
+            m_tailIndex = 0;
+            return;
+        }
+
+        if (base::m_capacity == size()) return;
+
+        reserve(size(), true);
+    }
+
+    /// @brief Changes the amount of elements in the buffer. Elements are removed from or default inserted to the back.
+    /// @param count Size of the buffer after the operation.
+    /// @pre value_type must satisfy DefaultInsertable.
+    /// @post size() == count. If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @throw Can throw std::bad_alloc or something from value_type's constructor.
+    /// @exception If any exception is thrown the elements of the buffer are not modified (Strong exception guarantee for the elements).
+    /// @details Linear complexity in relation to the difference of size() and count.
+    void resize(size_type count)
+    {
+        resizeBase(count);
+    }
+
+    /// @brief Changes the amount of elements in the buffer. Elements are removed from or copies of value are inserted to the back.
+    /// @param count Size of the buffer after the operation.
+    /// @param value Value of the inserted elements.
+    /// @pre value_type must satisfy CopyInsertable.
+    /// @post size() == count. If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @throw Can throw std::bad_alloc or something from value_type's constructor.
+    /// @exception If any exception is thrown the elements of the buffer are not modified (Strong exception guarantee for the elements).
+    /// @details Linear complexity in relation to the difference of size() and count.
+    void resize(size_type count, const value_type& value)
+    {
+        resizeBase(count, value);
     }
 
 //===========================================================
@@ -1441,13 +1913,7 @@ public:
     /// @details Constant complexity.
     reference back() noexcept
     {
-        // Since head points to next-to-last element, it needs to be decremented once to get the correct element. 
-        // If the index is at the beginning border of the allocated memory area it needs to be wrapped around to the end. 
-        if (m_headIndex == 0)
-        {
-            return base::m_data[base::m_capacity - 1];
-        }
-        return base::m_data[m_headIndex-1];
+        return base::m_data[CapacityPolicy::wrap(m_tailIndex + m_size - 1, base::m_capacity)];
     }
 
     /// @brief Returns a const-reference to the last element in the buffer. Behaviour is undefined for empty buffer.
@@ -1455,13 +1921,7 @@ public:
     /// @details Constant complexity.
     const_reference back() const noexcept
     {
-        // Since head points to next-to-last element, it needs to be decremented once to get the correct element. 
-        // If the index is at the beginning border of the allocated memory area it needs to be wrapped around to the end. 
-        if (m_headIndex == 0)
-        {
-            return base::m_data[base::m_capacity - 1];
-        }
-        return base::m_data[m_headIndex-1];
+        return base::m_data[CapacityPolicy::wrap(m_tailIndex + m_size - 1, base::m_capacity)];
     }
 
     /// @brief Construct iterator at begin.
@@ -1562,251 +2022,965 @@ public:
 
 
 private:
+
+    /// @brief Gets the address of an element for an iterator.
+    /// @param logicalIndex Logical index of the element.
+    /// @return Pointer to the element, or null pointer if logicalIndex is past the last element.
+    /// @details Constant complexity.
+    pointer _pointerAt(difference_type logicalIndex) const noexcept
+    {
+        if (static_cast<size_type>(logicalIndex) >= size())
+        {
+            return nullptr;
+        }
+        return base::m_data + CapacityPolicy::wrap(m_tailIndex + logicalIndex, base::m_capacity);
+    }
+
+    /// @brief Gets the logical index of an element pointed by an iterator.
+    /// @param ptr Pointer to an element, or null pointer for the past-the-last element.
+    /// @details Constant complexity.
+    difference_type _indexOf(const_pointer ptr) const noexcept
+    {
+        if (!ptr)
+        {
+            return size();
+        }
+        return CapacityPolicy::distance(m_tailIndex, ptr - base::m_data, base::m_capacity);
+    }
+
+    /// @brief Gets the address of the element following ptr.
+    /// @param ptr Pointer to an element.
+    /// @return Pointer to the next element, or null pointer if ptr pointed to the last element.
+    /// @details Constant complexity.
+    pointer _next(pointer ptr) const noexcept
+    {
+        if (++ptr == base::m_data + base::m_capacity)
+        {
+            ptr = base::m_data;
+        }
+        return ptr == base::m_data + _headIndex() ? nullptr : ptr;
+    }
+
+    /// @brief Splits the range between two element addresses into contiguous memory segments.
+    /// @param first Pointer to the first element, or null pointer for the past-the-last element.
+    /// @param last Pointer past the last element of the range, or null pointer for the past-the-last element.
+    /// @details Constant complexity.
+    std::pair<span, span> _segments(pointer first, pointer last) const noexcept
+    {
+        if (!first || first == last)
+        {
+            return {};
+        }
+
+        // Indices are used instead of addresses, since the first and the past-the-last slot are the same for a full buffer.
+        const auto index = _indexOf(first);
+        return _range(index, _indexOf(last) - index);
+    }
+
+    /// @brief Gets the address of the element preceding ptr.
+    /// @param ptr Pointer to an element, or null pointer for the past-the-last element.
+    /// @details Constant complexity.
+    pointer _prev(pointer ptr) const noexcept
+    {
+        if (!ptr)
+        {
+            ptr = base::m_data + _headIndex();
+        }
+        if (ptr == base::m_data)
+        {
+            ptr += base::m_capacity;
+        }
+        return ptr - 1;
+    }
      
-    explicit ring_buffer(base&& rBufBase) : base(std::forward<base>(rBufBase)), m_headIndex(0), m_tailIndex(0)
+    explicit ring_buffer(base&& rBufBase) : base(std::forward<base>(rBufBase)), m_size(0), m_tailIndex(0)
     {
     }
 
     void destroy_elements() noexcept
     {
-        for_each(begin(), end(), [this](T& elem) { alloc_traits::destroy(base::m_allocator, &elem); });
+        _destroySegments(_range(0, size()));
+    }
+
+    using _relocation_tag = std::conditional_t<is_trivially_relocatable<T>::value && _has_default_construct<Allocator>::value, _relocate_memcpy_tag,
+        std::conditional_t<std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value, _relocate_move_tag, _relocate_copy_tag>>;
+
+    /// @brief Splits a logical range of elements into contiguous memory segments.
+    /// @param first Logical index of the first element.
+    /// @param count Amount of elements in the range.
+    /// @details Constant complexity.
+    std::pair<span, span> _range(size_type first, size_type count) const noexcept
+    {
+        if (count == 0)
+        {
+            return {};
+        }
+
+        const auto start = CapacityPolicy::wrap(m_tailIndex + first, base::m_capacity);
+        const auto firstCount = std::min(count, base::m_capacity - start);
+
+        return {span(base::m_data + start, firstCount), span(base::m_data, count - firstCount)};
+    }
+
+    /// @brief Relocates all elements to uninitialized memory, optionally leaving a gap of uninitialized slots in the middle.
+    /// @param dest Pointer to memory that can hold size() + gapSize elements.
+    /// @param gapIndex Logical index of the first element placed after the gap.
+    /// @param gapSize Amount of slots left uninitialized before the element at gapIndex.
+    /// @post Elements are alive only in dest, the memory of the buffer holds no elements. Indices are not modified.
+    /// @throw Can throw from T's copy constructor, or from T's move constructor if T is not CopyInsertable.
+    /// @exception If any exception is thrown nothing is left constructed in dest and the elements remain in the buffer. Elements are unchanged unless a throwing move constructor was used.
+    /// @details Linear complexity in relation to buffer size. Trivially relocatable elements are copied with memcpy segment by segment.
+    void _relocate(pointer dest, size_type gapIndex = 0, size_type gapSize = 0)
+    {
+        const auto prefix = _range(0, gapIndex);
+        const auto suffix = _range(gapIndex, size() - gapIndex);
+
+        const span sources[] = {prefix.first, prefix.second, suffix.first, suffix.second};
+        const pointer targets[] = {dest, dest + prefix.first.size(), dest + gapIndex + gapSize, dest + gapIndex + gapSize + suffix.first.size()};
+
+        _relocate(sources, targets, _relocation_tag());
     }
 
+    void _relocate(const span (&sources)[4], const pointer (&targets)[4], _relocate_memcpy_tag) noexcept
+    {
+        for (size_t i = 0; i < 4; i++)
+        {
+            if (!sources[i].empty())
+            {
+                std::memcpy(static_cast<void*>(targets[i]), static_cast<const void*>(sources[i].data()), sources[i].size() * sizeof(T));
+            }
+        }
+    }
 
-    ///@note MUST HAVE NOTHROW MOVE CONSTRUCTION!!! Otherwise in case of exception leaves container in unspecified state.
-    template<typename InputIt, typename NoThrowForwardIt>
-    NoThrowForwardIt _uninitialized_move(InputIt first, InputIt last, NoThrowForwardIt dest_first)
+    template<typename Tag>
+    void _relocate(const span (&sources)[4], const pointer (&targets)[4], Tag tag)
     {
-        NoThrowForwardIt current = dest_first;
+        // With a nothrow move each source is destroyed right after it is moved from, while it is still in cache.
+        constexpr bool destroyEach = std::is_same<Tag, _relocate_move_tag>::value && std::is_nothrow_move_constructible<T>::value;
+
+        size_t segment = 0;
+        size_t current = 0;
 
         try
         {
-            for (size_t i = 0; first != last; ++first, (void)++current)
+            for (; segment < 4; segment++)
             {
-                alloc_traits::construct(base::m_allocator, current, std::move(*first));
+                for (current = 0; current < sources[segment].size(); current++)
+                {
+                    alloc_traits::construct(base::_allocator(), targets[segment] + current, _relocationSource(sources[segment].data()[current], tag));
+                    if (destroyEach)
+                    {
+                        alloc_traits::destroy(base::_allocator(), sources[segment].data() + current);
+                    }
+                }
             }
-            
         }
         catch (...)
         {
-            for (; dest_first != current; dest_first)
+            for (size_t i = 0; i <= segment; i++)
             {
-                alloc_traits::destroy(base::m_allocator, dest_first);
+                const auto constructed = i == segment ? current : sources[i].size();
+                for (size_t j = 0; j < constructed; j++)
+                {
+                    alloc_traits::destroy(base::_allocator(), targets[i] + j);
+                }
             }
-
             throw;
         }
-        return current;
+
+        if (!destroyEach)
+        {
+            destroy_elements();
+        }
     }
 
-    /// @brief Reserves more memory if needed for an increase in size. If more memory is needed, allocates (capacity * 1.5) or if that is not enough (capacity * 1.5 + increase).
-    /// @param increase Expected increase in size of the buffer, based on which memory is allocated.
-    /// @details Linear complexity in relation to buffer size if more memory needs to be allocated, otherwise constant complexity.
-    /// @exception May throw std::bad_alloc. If any exception is thrown this function does nothing. Strong exception guarantee.
-    /// @note This function should be called before increasing the size of the buffer.
-    void validateCapacity(size_t increase)
+    static value_type&& _relocationSource(value_type& value, _relocate_move_tag) noexcept
     {
-        if (base::m_capacity > size() + increase + allocBuffer) return;
+        return std::move(value);
+    }
 
-        reserve(base::m_capacity / 2 + base::m_capacity + allocBuffer);
+    static const value_type& _relocationSource(value_type& value, _relocate_copy_tag) noexcept
+    {
+        return value;
     }
 
-    /// @brief Base function for inserting elements by value and amount.
-    /// @tparama U value type of the inserted element.
-    /// @param pos Iterator pointing to the element where after insert new element will exist.
-    /// @param count Amount of elements to insert.
-    /// @param value Universal reference of value to insert.
-    /// @pre T Must satisfy CopyInsertable or MoveInsertable.
-    /// @return Returns iterator pointing to the first element inserted.
-    /// @throw Might throw std::bad_alloc from allocating memory, or something from T's move/copy constructor.
-    /// @exception  If any exception is thrown, function has no effect (Strong exception guarantee).
-    /// @details Linear complexity in relation to buffer size and inserted elements. O(n).
-    template<typename U>
-    iterator insertBase(const_iterator pos, const size_type count, U&& value)
+    // Memory can be grown in place if the allocator has the reallocate extension and the elements can be moved with memcpy.
+    using _reallocate_tag = std::integral_constant<bool, _has_reallocate<Allocator>::value && std::is_same<_relocation_tag, _relocate_memcpy_tag>::value>;
+
+    /// @brief Tries to grow the memory block in place with the allocator's reallocate extension.
+    /// @param newCapacity Requested capacity, rounded by the CapacityPolicy.
+    /// @return True if the buffer was grown. False if the allocator has no reallocate, elements are not trivially relocatable or reallocation failed.
+    /// @details Constant complexity if the elements do not wrap around, otherwise linear in the shorter wrapped segment.
+    bool tryReallocate(size_type newCapacity) noexcept
+    {
+        return tryReallocate(CapacityPolicy::round(newCapacity), _reallocate_tag());
+    }
+
+    bool tryReallocate(size_type, std::false_type) noexcept
+    {
+        return false;
+    }
+
+    bool tryReallocate(size_type newCapacity, std::true_type) noexcept
     {
-        if (pos == end())
+        const auto oldCapacity = base::m_capacity;
+        if (newCapacity <= oldCapacity)
         {
-            emplace_back(std::forward<U>(value));
-            return iterator(this, pos.getIndex());
+            return false;
         }
-        else if (pos == begin())
+
+        const auto grown = base::_allocator().reallocate(base::m_data, oldCapacity, newCapacity);
+        if (!grown)
         {
-            emplace_front(std::forward<U>(value));
-            return iterator(this, pos.getIndex());
+            return false;
         }
 
-        if (base::m_capacity < size() + count + allocBuffer)
-        {   
-            //Reallocate and move whole buffer. Strong guarantee
-            base tempCore(base::m_allocator, base::m_capacity * 3 / 2 );
-            ring_buffer temp(std::move(tempCore));
+        base::m_data = grown;
+        base::m_capacity = newCapacity;
 
-            // Copy elements up to pos
-            std::uninitialized_copy(cbegin(), pos, temp.m_data);
-            temp.m_headIndex = std::distance(cbegin(), pos);
+        if (m_tailIndex + m_size > oldCapacity)
+        {
+            // Elements wrap around the old end of memory. Move the shorter segment so that the elements are contiguous modulo the new capacity.
+            const auto added = newCapacity - oldCapacity;
+            const auto tailCount = oldCapacity - m_tailIndex;
+            const auto headCount = m_size - tailCount;
 
-            // Insert the element(s)
-            for (size_type i = 0; i < count; i++)
+            if (headCount <= added && headCount < tailCount)
+            {
+                // Append the wrapped prefix [0, headCount) after the old end.
+                std::memcpy(static_cast<void*>(base::m_data + oldCapacity), static_cast<const void*>(base::m_data), headCount * sizeof(T));
+            }
+            else
             {
-                alloc_traits::construct(temp.m_allocator, temp.m_data + temp.m_headIndex, std::forward<U>(value));
-                ++temp.m_headIndex;
+                // Shift the tail segment [tail, oldCapacity) to the new end of memory.
+                std::memmove(static_cast<void*>(base::m_data + m_tailIndex + added), static_cast<const void*>(base::m_data + m_tailIndex), tailCount * sizeof(T));
+                m_tailIndex += added;
             }
+        }
 
-            // Copy elements after pos
-            std::uninitialized_copy(pos, cend(), temp.m_data + temp.m_headIndex);
-            temp.m_headIndex += std::distance(pos, cend());
+        return true;
+    }
 
-            // Swap whole buffer.
-            swap(temp);
-            return iterator(this, pos.getIndex());
-        }
-        else
-        {
-        // Not at end, provide basic guarantee.
-            iterator it(this, pos.getIndex());
+    // Growing and rejecting policies call grow, which throws std::length_error for the rejecting policy before anything is modified.
+    template<class Policy, class... Args>
+    void overflowFront(Policy, Args&&... args)
+    {
+        growFront(_reallocate_tag(), std::forward<Args>(args)...);
+    }
 
-            //Construct temporary
-            _alloc_temp<Allocator> tempObj(base::m_allocator, std::forward<U>(value));
+    /// @brief Replaces the last element with an element constructed in front of the first element. The slot of the last element becomes the new first slot.
+    /// The new element is constructed to a temporary before the last element is destroyed, so arguments may refer to the last element.
+    /// @exception If constructing the element throws, function has no effect. If the move constructor of value_type throws, the last element is lost (Basic exception guarantee).
+    /// @details Constant complexity. If the buffer has no capacity for elements, the element is discarded.
+    template<class... Args>
+    void overflowFront(overwrite_overflow_policy, Args&&... args)
+    {
+        if (base::m_capacity == 0) return;
 
-            //Provide basic guarantee. TODO optimize to move toward closer end.
-            auto last = end();
-            alloc_traits::construct(base::m_allocator, &*last, std::move(*(last - 1)));
-            increment(m_headIndex);
-            std::move_backward(it, last - 1, last);
+        _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<Args>(args)...);
 
-            *it = std::move(tempObj._getValue());
+        auto newIndex = m_tailIndex;
+        decrement(newIndex);
+        alloc_traits::destroy(base::_allocator(), base::m_data + newIndex);
 
-            return it;
+        try
+        {
+            alloc_traits::construct(base::_allocator(), base::m_data + newIndex, std::move(tempObj._getValue()));
+        }
+        catch (...)
+        {
+            --m_size;
+            throw;
         }
+
+        m_tailIndex = newIndex;
     }
 
-    /// @brief Base function for inserting elements from a range of [rangeBegin, rangeEnd).
-    /// @tparam OutputIt type of the source ranges output iterator.
-    /// @param pos Iterator pointing to the element where after insert new element will exist.
-    /// @param rangeBegin Iterator pointing to the first element of the range.
-    /// @param rangeEnd Iterator pointing past the last element to be inserted.
-    /// @return Returns iterator pointing to the first element inserted.
-    /// @pre value_type must meet CopyInsertable. InputIt must be deferencable to value_type, and incrementing rangeBegin possibly multiple times should reach rangeEnd. Otherwise behaviour is undefined.
-    /// @post Each iterator in [rangeBegin, rangeEnd) is dereferenced once.
-    /// @throw Might throw std::bad_alloc from allocating memory and rotate(), or something from T's move/copy constructor.
-    /// @exception  If any exception is thrown, invariants are retained. (Basic Exception guarantee).
-    /// @details Linear Complexity in relation to amount of inserted elements (O(n*2) from element construction and rotation).
-    template<typename OutputIt>
-    iterator insertRangeBase(const_iterator pos, OutputIt rangeBegin, OutputIt rangeEnd)
+    template<class Policy, class... Args>
+    void overflowBack(Policy, Args&&... args)
     {
-        const auto amount = std::distance<OutputIt>(rangeBegin, rangeEnd);
+        growBack(_reallocate_tag(), std::forward<Args>(args)...);
+    }
 
-        base tempCore(base::m_allocator, base::m_capacity < size() + amount + allocBuffer ? base::m_capacity * 3 / 2 : base::m_capacity);
-        ring_buffer temp(std::move(tempCore));
+    /// @brief Replaces the first element with an element constructed after the last element. The slot of the first element becomes the new last slot.
+    /// The new element is constructed to a temporary before the first element is destroyed, so arguments may refer to the first element.
+    /// @exception If constructing the element throws, function has no effect. If the move constructor of value_type throws, the first element is lost (Basic exception guarantee).
+    /// @details Constant complexity. If the buffer has no capacity for elements, the element is discarded.
+    template<class... Args>
+    void overflowBack(overwrite_overflow_policy, Args&&... args)
+    {
+        if (base::m_capacity == 0) return;
 
-        std::uninitialized_copy(cbegin(), pos, temp.m_data);
-        temp.m_headIndex = std::distance(cbegin(), pos);
+        _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<Args>(args)...);
 
+        alloc_traits::destroy(base::_allocator(), base::m_data + m_tailIndex);
 
-        for (; rangeBegin != rangeEnd; ++rangeBegin)
+        try
         {
-            alloc_traits::construct(temp.m_allocator, temp.m_data + temp.m_headIndex, *rangeBegin);
-            ++temp.m_headIndex;
+            alloc_traits::construct(base::_allocator(), base::m_data + m_tailIndex, std::move(tempObj._getValue()));
+        }
+        catch (...)
+        {
+            increment(m_tailIndex);
+            --m_size;
+            throw;
         }
 
-        // Copy elements after pos
-        std::uninitialized_copy(pos, cend(), temp.m_data + temp.m_headIndex);
-        temp.m_headIndex += std::distance(pos, cend());
-
-        // Swap whole buffer.
-        swap(temp);
-
-        return iterator(this, pos.getIndex());
+        increment(m_tailIndex);
     }
 
-    /// @brief Base function for erasing elements from the buffer.
-    /// @param first Iterator pointing to the first element of the range to erase.
-    /// @param last Iterator pointing to past the last element to erase.
-    /// @return Returns an iterator pointing to the element immediately after the erased elements.
-    /// @pre First and last must be valid iterators to *this.
-    /// @exception If value_types swap is NoThrow, function is noexcept. If swap throws, behavior is undefined.
-    iterator eraseBase(const_iterator first, const_iterator last)
+    /// @brief Grows the buffer and constructs an element in front of the first element. The element is constructed in the new memory before the old elements are relocated.
+    /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
+    /// @details Linear complexity in relation to buffer size.
+    template<class... Args>
+    void growFront(std::false_type, Args&&... args)
     {
-        iterator returnIt(this, first.getIndex());
+        const auto sz = size();
+        base temp(base::_allocator(), grownCapacity(sz + 1));
 
-        const auto diff = std::distance(first, last);
+        // Construct the new element first so that a throwing constructor leaves the buffer untouched.
+        alloc_traits::construct(base::_allocator(), temp.m_data + temp.m_capacity - 1, std::forward<Args>(args)...);
 
-        if (diff > 0)
+        try
         {
-            auto tempIt(returnIt);
-
-            // Swap to be erased elements to the end...
-            for (; tempIt + diff < end(); tempIt++)
-            {
-                std::swap(*(tempIt + diff), *tempIt);
-            }
-
-            // ... and destroy them.
-            for (; tempIt < end(); tempIt++)
-            {
-                alloc_traits::destroy(base::m_allocator, &*(tempIt));
-            }
-
-            decrement(m_headIndex, diff);
+            _relocate(temp.m_data);
         }
-        return returnIt;
-    }
-
-    /// @brief Increment an index. The ringbuffer internally increments the head and tail index when adding elements.
-    /// @param index The index to increment.
-    /// @details Constant complexity.
-    void increment(size_t& index) noexcept
-    {
-        ++index;
-        // Wrap index around at end of physical memory area.
-        if(index >= base::m_capacity)
+        catch (...)
         {
-            index = 0;
+            alloc_traits::destroy(base::_allocator(), temp.m_data + temp.m_capacity - 1);
+            throw;
         }
+
+        base::swap(*this, temp);
+        m_size = sz + 1;
+        m_tailIndex = base::m_capacity - 1;
     }
 
-    /// @brief Increments an index multiple times. The ringbuffer internally increments the head and tail index when adding elements.
-    /// @param index Index to increment.
-    /// @param times Amount of increments.
-    /// @details Linear complexity in relation to size of times argument.
-    void increment(size_t& index, size_t times) noexcept
+    // Reallocating may move the memory block, so the element is constructed before the arguments referring to elements of the buffer are invalidated.
+    template<class... Args>
+    void growFront(std::true_type, Args&&... args)
     {
-        while(times > 0)
+        _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<Args>(args)...);
+
+        if (!tryReallocate(grownCapacity(size() + 1)))
         {
-            increment(index);
-            times--;
+            growFront(std::false_type(), std::move(tempObj._getValue()));
+            return;
         }
+
+        auto newIndex = m_tailIndex;
+        decrement(newIndex);
+        alloc_traits::construct(base::_allocator(), base::m_data + newIndex, std::move(tempObj._getValue()));
+        m_tailIndex = newIndex;
+        ++m_size;
     }
 
-    /// @brief Decrements an index. The ringbuffer internally decrements the head and tail index when removing elements.
-    /// @param index The index to decrement.
-    /// @details Constant complexity.
-    void decrement(size_t& index) noexcept
+    /// @brief Grows the buffer and constructs an element after the last element. The element is constructed in the new memory before the old elements are relocated.
+    /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
+    /// @details Linear complexity in relation to buffer size.
+    template<class... Args>
+    void growBack(std::false_type, Args&&... args)
     {
-        if(index == 0)
+        const auto sz = size();
+        base temp(base::_allocator(), grownCapacity(sz + 1));
+
+        // Construct the new element first so that a throwing constructor leaves the buffer untouched. This also keeps arguments referring to elements of the buffer valid.
+        alloc_traits::construct(base::_allocator(), temp.m_data + sz, std::forward<Args>(args)...);
+
+        try
         {
-            index = base::m_capacity - 1;
+            _relocate(temp.m_data);
         }
-        else
+        catch (...)
         {
-            --index;
+            alloc_traits::destroy(base::_allocator(), temp.m_data + sz);
+            throw;
         }
+
+        base::swap(*this, temp);
+        m_tailIndex = 0;
+        m_size = sz + 1;
     }
-    
-    /// @brief Decrements an index multiple times. The ringbuffer internally decrements the head and tail index when removing elements.
-    /// @param index Index to decrement.
-    /// @param times Amount of decrements.
-    void decrement(size_t& index, size_t times) noexcept
+
+    template<class... Args>
+    void growBack(std::true_type, Args&&... args)
     {
-        while(times > 0)
+        _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<Args>(args)...);
+
+        if (!tryReallocate(grownCapacity(size() + 1)))
         {
-            decrement(index);
-            times--;
+            growBack(std::false_type(), std::move(tempObj._getValue()));
+            return;
         }
+
+        alloc_traits::construct(base::_allocator(), base::m_data + _headIndex(), std::move(tempObj._getValue()));
+        ++m_size;
     }
 
-    size_type m_headIndex; /*!< Index of the head. Index pointing to past the last element.*/
-    size_type m_tailIndex; /*!< Index of the tail. Index to the first element in the buffer.*/
+    /// @brief Constructs elements from a range into memory segments.
+    /// @param segs Segments of uninitialized memory, filled in order.
+    /// @param first Iterator to the first element of the source range. The range must hold at least as many elements as the segments.
+    /// @exception If any exception is thrown, elements constructed by this function are destroyed.
+    /// @details Linear complexity in relation to the size of the segments.
+    template<typename ForwardIt>
+    ForwardIt _constructSegments(const std::pair<span, span>& segs, ForwardIt first)
+    {
+        first = _constructSegment(segs.first, first);
+
+        try
+        {
+            return _constructSegment(segs.second, first);
+        }
+        catch (...)
+        {
+            _destroySegments({segs.first, span()});
+            throw;
+        }
+    }
+
+    template<typename ForwardIt>
+    ForwardIt _constructSegment(const span& seg, ForwardIt first)
+    {
+        using category = typename std::iterator_traits<ForwardIt>::iterator_category;
+        return _constructSegment(seg, first, std::integral_constant<bool, _has_default_construct<Allocator>::value && std::is_base_of<std::random_access_iterator_tag, category>::value>());
+    }
+
+    // The allocator constructs with placement new, so the standard algorithm can be used. It copies trivial types with memmove.
+    template<typename RandomIt>
+    RandomIt _constructSegment(const span& seg, RandomIt first, std::true_type)
+    {
+        const auto last = first + seg.size();
+        std::uninitialized_copy(first, last, seg.data());
+        return last;
+    }
+
+    template<typename ForwardIt>
+    ForwardIt _constructSegment(const span& seg, ForwardIt first, std::false_type)
+    {
+        size_type current = 0;
+
+        try
+        {
+            for (; current < seg.size(); ++current, (void)++first)
+            {
+                alloc_traits::construct(base::_allocator(), seg.data() + current, *first);
+            }
+        }
+        catch (...)
+        {
+            _destroySegments({span(seg.data(), current), span()});
+            throw;
+        }
+        return first;
+    }
+
+    /// @brief Constructs elements from arguments into memory segments.
+    /// @exception If any exception is thrown, elements constructed by this function are destroyed.
+    template<typename... Args>
+    void _fillSegments(const std::pair<span, span>& segs, const Args&... args)
+    {
+        size_type constructed = 0;
+        const span all[] = {segs.first, segs.second};
+
+        try
+        {
+            for (const auto& seg : all)
+            {
+                for (auto it = seg.begin(); it != seg.end(); ++it, (void)++constructed)
+                {
+                    alloc_traits::construct(base::_allocator(), it, args...);
+                }
+            }
+        }
+        catch (...)
+        {
+            const auto firstCount = std::min(constructed, segs.first.size());
+            _destroySegments({span(segs.first.data(), firstCount), span(segs.second.data(), constructed - firstCount)});
+            throw;
+        }
+    }
+
+    /// @brief Gets the address of a slot by logical index. Unlike _pointerAt, also works for the free slots after the last element.
+    /// @param logicalIndex Logical index of the slot. Must be less than capacity.
+    /// @details Constant complexity.
+    pointer _address(size_type logicalIndex) const noexcept
+    {
+        return base::m_data + CapacityPolicy::wrap(m_tailIndex + logicalIndex, base::m_capacity);
+    }
+
+    /// @brief Move assigns count elements starting from logical index src to the elements starting from logical index dst. The ranges may overlap.
+    /// @details Linear complexity in relation to count. The elements are moved in at most three contiguous chunks with std::move or std::move_backward.
+    void _moveElements(size_type src, size_type count, size_type dst)
+    {
+        if (dst < src)
+        {
+            while (count > 0)
+            {
+                const auto from = _address(src);
+                const auto to = _address(dst);
+                const auto len = std::min(count, static_cast<size_type>(base::m_data + base::m_capacity - std::max(from, to)));
+
+                std::move(from, from + len, to);
+                src += len;
+                dst += len;
+                count -= len;
+            }
+        }
+        else if (src < dst)
+        {
+            while (count > 0)
+            {
+                const auto fromEnd = _address(src + count - 1) + 1;
+                const auto toEnd = _address(dst + count - 1) + 1;
+                const auto len = std::min(count, static_cast<size_type>(std::min(fromEnd, toEnd) - base::m_data));
+
+                std::move_backward(fromEnd - len, fromEnd, toEnd);
+                count -= len;
+            }
+        }
+    }
+
+    /// @brief Destroys the elements in memory segments. Skipped for trivially destructible types if the allocator does not customize destruction.
+    /// @details Linear complexity in relation to the size of the segments, or constant if destruction is skipped.
+    void _destroySegments(const std::pair<span, span>& segs) noexcept
+    {
+        if (std::is_trivially_destructible<T>::value && _has_default_construct<Allocator>::value) return;
+
+        for (auto& elem : segs.first)
+        {
+            alloc_traits::destroy(base::_allocator(), &elem);
+        }
+        for (auto& elem : segs.second)
+        {
+            alloc_traits::destroy(base::_allocator(), &elem);
+        }
+    }
+
+    /// @brief Move constructs count elements starting from logical index src to uninitialized slots starting from logical index dst. The ranges must not overlap.
+    /// @exception If any exception is thrown, elements constructed by this function are destroyed.
+    /// @details Linear complexity in relation to count.
+    void _moveConstruct(size_type src, size_type count, size_type dst)
+    {
+        _constructSegments(_range(dst, count), std::make_move_iterator(begin() + src));
+    }
+
+    /// @brief Assigns elements from a range to the elements in memory segments.
+    /// @return Iterator past the last source element used.
+    /// @details Linear complexity in relation to the size of the segments.
+    template<typename ForwardIt>
+    ForwardIt _assignSegments(const std::pair<span, span>& segs, ForwardIt first)
+    {
+        for (auto& elem : segs.first)
+        {
+            elem = *first;
+            ++first;
+        }
+        for (auto& elem : segs.second)
+        {
+            elem = *first;
+            ++first;
+        }
+        return first;
+    }
+
+    /// @brief Inserts count elements from a range at a logical index without reallocating. The elements on the shorter side of the index are shifted to make room,
+    /// so insertion in the first half uses the free slots before the tail and insertion in the second half the free slots after the head.
+    /// @param index Logical index of the first inserted element.
+    /// @param count Amount of elements to insert.
+    /// @param first Iterator to the first element of the source range. The range must not refer to elements of the buffer.
+    /// @pre Capacity must hold size() + count elements.
+    /// @exception If constructing an element from the range throws before any element is moved the function has no effect. Otherwise invariants are preserved (Basic exception guarantee).
+    /// @details Linear complexity in relation to count plus the amount of elements on the shorter side.
+    template<typename ForwardIt>
+    void _insertInPlace(size_type index, size_type count, ForwardIt first)
+    {
+        const auto sz = size();
+
+        if (index < sz - index)
+        {
+            // Logical index of the new first element, counted from the current tail.
+            const auto front = base::m_capacity - count;
+
+            if (index >= count)
+            {
+                // The first count elements move to the free slots, the rest are shifted by assignment.
+                _moveConstruct(0, count, front);
+                decrement(m_tailIndex, count);
+                m_size += count;
+                _moveElements(2 * count, index - count, count);
+                _assignSegments(_range(index, count), first);
+            }
+            else
+            {
+                // Part of the new elements go to free slots, so they are constructed before anything is moved.
+                const auto created = _range(front + index, count - index);
+                const auto rest = _constructSegments(created, first);
+                try
+                {
+                    _moveConstruct(0, index, front);
+                }
+                catch (...)
+                {
+                    _destroySegments(created);
+                    throw;
+                }
+                decrement(m_tailIndex, count);
+                m_size += count;
+                _assignSegments(_range(count, index), rest);
+            }
+        }
+        else
+        {
+            const auto after = sz - index;
+
+            if (after >= count)
+            {
+                _moveConstruct(sz - count, count, sz);
+                m_size += count;
+                _moveElements(index, after - count, index + count);
+                _assignSegments(_range(index, count), first);
+            }
+            else
+            {
+                const auto created = _range(sz, count - after);
+                _constructSegments(created, std::next(first, after));
+                try
+                {
+                    _moveConstruct(index, after, index + count);
+                }
+                catch (...)
+                {
+                    _destroySegments(created);
+                    throw;
+                }
+                m_size += count;
+                _assignSegments(_range(index, after), first);
+            }
+        }
+    }
+
+    template<typename ForwardIt>
+    void appendBase(ForwardIt sourceBegin, ForwardIt sourceEnd, std::forward_iterator_tag)
+    {
+        const size_type count = std::distance(sourceBegin, sourceEnd);
+        if (count == 0) return;
+
+        validateCapacity(count);
+
+        // Free slots after the head.
+        _constructSegments(_range(size(), count), sourceBegin);
+        m_size += count;
+    }
+
+    template<typename InputIt>
+    void appendBase(InputIt sourceBegin, InputIt sourceEnd, std::input_iterator_tag)
+    {
+        for (; sourceBegin != sourceEnd; ++sourceBegin)
+        {
+            emplace_back(*sourceBegin);
+        }
+    }
+
+    template<typename... Args>
+    void resizeBase(size_type count, const Args&... args)
+    {
+        const auto sz = size();
+
+        if (count <= sz)
+        {
+            pop_back_n(sz - count);
+            return;
+        }
+
+        validateCapacity(count - sz);
+
+        _fillSegments(_range(sz, count - sz), args...);
+        m_size = count;
+    }
+
+    /// @brief Gets the physical index past the last element, where push_back constructs the next element. Equals m_tailIndex when the buffer is full.
+    /// @details Constant complexity.
+    size_type _headIndex() const noexcept
+    {
+        return CapacityPolicy::wrap(m_tailIndex + m_size, base::m_capacity);
+    }
+
+    /// @brief Gets the capacity to grow to, as decided by the GrowthPolicy.
+    /// @param required Minimum capacity needed.
+    /// @throw Throws std::length_error if the OverflowPolicy keeps the buffer bounded.
+    /// @details Constant complexity.
+    size_type grownCapacity(size_type required) const
+    {
+        return grownCapacity(required, OverflowPolicy());
+    }
+
+    size_type grownCapacity(size_type required, grow_overflow_policy) const noexcept
+    {
+        return GrowthPolicy::grow(base::m_capacity, required, sizeof(T));
+    }
+
+    template<class Policy>
+    size_type grownCapacity(size_type, Policy) const
+    {
+        throw std::length_error("ring_buffer is full");
+    }
+
+    /// @brief Reserves more memory if needed for an increase in size. The new capacity is decided by the GrowthPolicy.
+    /// @param increase Expected increase in size of the buffer, based on which memory is allocated.
+    /// @details Linear complexity in relation to buffer size if more memory needs to be allocated, otherwise constant complexity.
+    /// @exception May throw std::bad_alloc. If any exception is thrown this function does nothing. Strong exception guarantee.
+    /// @note This function should be called before increasing the size of the buffer.
+    void validateCapacity(size_t increase)
+    {
+        if (base::m_capacity >= size() + increase) return;
+
+        reserve(grownCapacity(size() + increase));
+    }
+
+    /// @brief Base function for inserting elements by value and amount.
+    /// @tparama U value type of the inserted element.
+    /// @param pos Iterator pointing to the element where after insert new element will exist.
+    /// @param count Amount of elements to insert. Must be 1 if value is an rvalue.
+    /// @param value Universal reference of value to insert.
+    /// @pre T Must satisfy CopyInsertable or MoveInsertable.
+    /// @return Returns iterator pointing to the first element inserted.
+    /// @throw Might throw std::bad_alloc from allocating memory, or something from T's move/copy constructor.
+    /// @exception If memory is reallocated or the elements are inserted at either end, the function has no effect if an exception is thrown (Strong exception guarantee).
+    /// Otherwise invariants are preserved (Basic exception guarantee).
+    /// @details Linear complexity in relation to inserted elements and the distance from pos to the closer end of the buffer, or to buffer size if memory is reallocated.
+    template<typename U>
+    iterator insertBase(const_iterator pos, const size_type count, U&& value)
+    {
+        const auto index = pos.getIndex();
+
+        if (count == 1 && pos == end())
+        {
+            emplace_back(std::forward<U>(value));
+            return iterator(this, index);
+        }
+        else if (count == 1 && pos == begin())
+        {
+            emplace_front(std::forward<U>(value));
+            return iterator(this, index);
+        }
+
+        if (base::m_capacity < size() + count)
+        {   
+            //Reallocate and relocate whole buffer around the inserted elements. Strong guarantee
+            const auto sz = size();
+            base temp(base::_allocator(), grownCapacity(sz + count));
+
+            // Insert the element(s) first, so that the buffer is untouched if a constructor throws.
+            size_type constructed = 0;
+            try
+            {
+                for (; constructed < count; constructed++)
+                {
+                    alloc_traits::construct(base::_allocator(), temp.m_data + index + constructed, std::forward<U>(value));
+                }
+
+                _relocate(temp.m_data, index, count);
+            }
+            catch (...)
+            {
+                for (size_type i = 0; i < constructed; i++)
+                {
+                    alloc_traits::destroy(base::_allocator(), temp.m_data + index + i);
+                }
+                throw;
+            }
+
+            base::swap(*this, temp);
+            m_size = sz + count;
+            m_tailIndex = 0;
+
+            return iterator(this, index);
+        }
+        else
+        {
+            // Copy of the value, as it may refer to an element that gets shifted.
+            _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<U>(value));
+            insertValue(index, count, tempObj._getValue(), std::is_lvalue_reference<U>());
+
+            return iterator(this, index);
+        }
+    }
+
+    // Rvalues are inserted only once, so the value is moved.
+    void insertValue(size_type index, size_type, value_type& value, std::false_type)
+    {
+        _insertInPlace(index, 1, std::make_move_iterator(std::addressof(value)));
+    }
+
+    void insertValue(size_type index, size_type count, value_type& value, std::true_type)
+    {
+        _insertInPlace(index, count, _repeat_iterator<T>{std::addressof(value), 0});
+    }
+
+    /// @brief Base function for inserting elements from a range of [rangeBegin, rangeEnd). If the capacity suffices, the elements on the shorter side of pos are shifted
+    /// to open a gap, and the range is constructed directly into it. Otherwise the buffer is relocated to new memory around the range.
+    /// @tparam ForwardIt type of the source ranges iterator.
+    /// @param pos Iterator pointing to the element where after insert new element will exist.
+    /// @param rangeBegin Iterator pointing to the first element of the range.
+    /// @param rangeEnd Iterator pointing past the last element to be inserted.
+    /// @return Returns iterator pointing to the first element inserted.
+    /// @pre value_type must meet CopyInsertable. ForwardIt must be deferencable to value_type, and incrementing rangeBegin possibly multiple times should reach rangeEnd. Otherwise behaviour is undefined.
+    /// @throw Might throw std::bad_alloc from allocating memory, or something from T's move/copy constructor.
+    /// @exception If memory is reallocated or the range is inserted at either end, the function has no effect if an exception is thrown (Strong exception guarantee).
+    /// Otherwise invariants are retained (Basic Exception guarantee).
+    /// @details Linear complexity in relation to inserted elements and the distance from pos to the closer end of the buffer, or to buffer size if memory is reallocated.
+    template<typename ForwardIt>
+    iterator insertRangeBase(const_iterator pos, ForwardIt rangeBegin, ForwardIt rangeEnd, std::forward_iterator_tag)
+    {
+        const size_type amount = std::distance(rangeBegin, rangeEnd);
+        const auto index = pos.getIndex();
+        const auto sz = size();
+
+        if (amount == 0)
+        {
+            return iterator(this, index);
+        }
+
+        // A range of the buffer's own elements would be overwritten while shifting or left dangling by realloc, so it is always copied to new memory.
+        const bool aliased = _refersToElements(rangeBegin);
+        const bool fits = base::m_capacity >= sz + amount;
+
+        if (!aliased && (fits || tryReallocate(grownCapacity(sz + amount))))
+        {
+            _insertInPlace(index, amount, rangeBegin);
+            return iterator(this, index);
+        }
+
+        base temp(base::_allocator(), fits ? base::m_capacity : grownCapacity(sz + amount));
+
+        // Construct the range first, so that the buffer is untouched if a constructor throws. Also keeps ranges from *this valid.
+        size_type constructed = 0;
+        try
+        {
+            for (; constructed < amount; ++rangeBegin, (void)++constructed)
+            {
+                alloc_traits::construct(base::_allocator(), temp.m_data + index + constructed, *rangeBegin);
+            }
+
+            _relocate(temp.m_data, index, amount);
+        }
+        catch (...)
+        {
+            for (size_type i = 0; i < constructed; i++)
+            {
+                alloc_traits::destroy(base::_allocator(), temp.m_data + index + i);
+            }
+            throw;
+        }
+
+        base::swap(*this, temp);
+        m_size = sz + amount;
+        m_tailIndex = 0;
+
+        return iterator(this, index);
+    }
+
+    // Single pass input iterators can't be counted in advance, so the range is first read into a temporary buffer.
+    template<typename InputIt>
+    iterator insertRangeBase(const_iterator pos, InputIt rangeBegin, InputIt rangeEnd, std::input_iterator_tag)
+    {
+        ring_buffer temp(base::_allocator());
+        temp.append(rangeBegin, rangeEnd);
+
+        return insertRangeBase(pos, std::make_move_iterator(temp.begin()), std::make_move_iterator(temp.end()), std::random_access_iterator_tag());
+    }
+
+    /// @brief Checks if an iterator refers to an element in the memory of the buffer.
+    /// @details Constant complexity. Iterators that do not dereference to an lvalue never refer to the buffer.
+    template<typename It>
+    bool _refersToElements(const It& it) const noexcept
+    {
+        return _refersToElements(it, std::is_lvalue_reference<typename std::iterator_traits<It>::reference>());
+    }
+
+    template<typename It>
+    bool _refersToElements(const It& it, std::true_type) const noexcept
+    {
+        const std::less<const void*> less;
+        const void* address = std::addressof(*it);
+        return !less(address, base::m_data) && less(address, base::m_data + base::m_capacity);
+    }
+
+    template<typename It>
+    bool _refersToElements(const It&, std::false_type) const noexcept
+    {
+        return false;
+    }
+
+    /// @brief Base function for erasing elements from the buffer. Elements on the shorter side of the range are shifted over the erased elements by move assignment,
+    /// and the vacated slots at that end of the buffer are destroyed.
+    /// @param first Iterator pointing to the first element of the range to erase.
+    /// @param last Iterator pointing to past the last element to erase.
+    /// @return Returns an iterator pointing to the element immediately after the erased elements.
+    /// @pre First and last must be valid iterators to *this.
+    /// @exception If value_types move assignment is NoThrow, function is noexcept. If it throws, the buffer is left in a valid but unspecified state.
+    /// @details Linear complexity in relation to the size of the range plus the amount of elements on the shorter side. Erasing at begin() or end() only destroys the range.
+    iterator eraseBase(const_iterator first, const_iterator last)
+    {
+        const auto index = static_cast<size_type>(first.getIndex());
+        const auto count = static_cast<size_type>(std::distance(first, last));
+
+        if (count > 0)
+        {
+            if (index < size() - index - count)
+            {
+                // Fewer elements before the range. Shift them toward the end and release the front.
+                _moveElements(0, index, count);
+                pop_front_n(count);
+            }
+            else
+            {
+                _moveElements(index + count, size() - index - count, index);
+                pop_back_n(count);
+            }
+        }
+
+        // Iterator is constructed after erasing, so that it becomes end() if the erased range reached the end.
+        return iterator(this, index);
+    }
+
+    /// @brief Increment an index. The ringbuffer internally increments the head and tail index when adding elements.
+    /// @param index The index to increment.
+    /// @details Constant complexity.
+    void increment(size_t& index) noexcept
+    {
+        // Wrap index around at end of physical memory area.
+        index = CapacityPolicy::next(index, base::m_capacity);
+    }
+
+    /// @brief Increments an index multiple times. The ringbuffer internally increments the head and tail index when adding elements.
+    /// @param index Index to increment.
+    /// @param times Amount of increments. Must not be larger than capacity.
+    /// @details Constant complexity.
+    void increment(size_t& index, size_t times) noexcept
+    {
+        index = CapacityPolicy::wrap(index + times, base::m_capacity);
+    }
+
+    /// @brief Decrements an index. The ringbuffer internally decrements the head and tail index when removing elements.
+    /// @param index The index to decrement.
+    /// @details Constant complexity.
+    void decrement(size_t& index) noexcept
+    {
+        index = CapacityPolicy::prev(index, base::m_capacity);
+    }
+    
+    /// @brief Decrements an index multiple times. The ringbuffer internally decrements the head and tail index when removing elements.
+    /// @param index Index to decrement.
+    /// @param times Amount of decrements. Must not be larger than capacity.
+    /// @details Constant complexity.
+    void decrement(size_t& index, size_t times) noexcept
+    {
+        index = CapacityPolicy::wrap(index + base::m_capacity - times, base::m_capacity);
+    }
+
+    size_type m_size; /*!< Amount of elements in the buffer.*/
+    size_type m_tailIndex; /*!< Index of the tail. Index to the first element in the buffer.*/
 
 };
 
@@ -1821,8 +2995,8 @@ private:
 /// @param lhs Left hand side operand
 /// @param rhs right hand side operand
 /// @return returns true if the buffers elements compare equal.
-template<typename T , typename Alloc>
-inline bool operator==(const ring_buffer<T,Alloc>& lhs, const ring_buffer<T,Alloc>& rhs)
+template<typename T, typename Alloc, typename Policy, typename Growth, typename Overflow>
+inline bool operator==(const ring_buffer<T,Alloc,Policy,Growth,Overflow>& lhs, const ring_buffer<T,Alloc,Policy,Growth,Overflow>& rhs)
 {
     if(lhs.size() != rhs.size())
     {
@@ -1846,10 +3020,258 @@ inline bool operator==(const ring_buffer<T,Alloc>& lhs, const ring_buffer<T,Allo
 /// @param lhs Left hand side operand.
 /// @param rhs Right hand side operand.
 /// @return returns True if any of the elements are not equal.
-template<typename T,typename Alloc>
-inline bool operator!=(const ring_buffer<T,Alloc>& lhs, const ring_buffer<T,Alloc>& rhs)
+template<typename T, typename Alloc, typename Policy, typename Growth, typename Overflow>
+inline bool operator!=(const ring_buffer<T,Alloc,Policy,Growth,Overflow>& lhs, const ring_buffer<T,Alloc,Policy,Growth,Overflow>& rhs)
 {
     return !(lhs == rhs);
 }
 
+//===========================
+// Segment-aware algorithms
+//===========================
+
+/// @brief Algorithms that split ring_buffer iterator ranges into their contiguous memory segments and run the standard algorithm
+/// on raw pointers of each segment. For any other iterators the call is forwarded to the standard algorithm as is.
+namespace rbuf
+{
+    template<typename It, typename = void>
+    struct is_ring_buffer_iterator : std::false_type {};
+
+    template<typename It>
+    struct is_ring_buffer_iterator<It, decltype(void(std::declval<typename It::container_type*>()))> : std::true_type {};
+
+    template<typename It>
+    using is_random_access = std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>;
+
+    /// @brief Gets the iterator pointing to ptr which is in the segments of [first, last).
+    template<typename It, typename Segments, typename Ptr>
+    It _fromSegments(It first, const Segments& segs, Ptr ptr)
+    {
+        if (ptr >= segs.first.begin() && ptr < segs.first.end())
+        {
+            return first + (ptr - segs.first.begin());
+        }
+        return first + (segs.first.size() + (ptr - segs.second.begin()));
+    }
+
+    template<typename InputIt, typename T>
+    InputIt _find(InputIt first, InputIt last, const T& value, std::false_type)
+    {
+        return std::find(first, last, value);
+    }
+
+    template<typename InputIt, typename T>
+    InputIt _find(InputIt first, InputIt last, const T& value, std::true_type)
+    {
+        const auto segs = first.getSegments(last);
+
+        auto found = std::find(segs.first.begin(), segs.first.end(), value);
+        if (found != segs.first.end())
+        {
+            return _fromSegments(first, segs, found);
+        }
+
+        found = std::find(segs.second.begin(), segs.second.end(), value);
+        if (found != segs.second.end())
+        {
+            return _fromSegments(first, segs, found);
+        }
+        return last;
+    }
+
+    /// @brief Finds the first element equal to value in [first, last).
+    /// @details Linear complexity. For ring_buffer iterators the search runs on at most two contiguous segments.
+    template<typename InputIt, typename T>
+    InputIt find(InputIt first, InputIt last, const T& value)
+    {
+        return _find(first, last, value, is_ring_buffer_iterator<InputIt>{});
+    }
+
+    template<typename InputIt, typename T>
+    typename std::iterator_traits<InputIt>::difference_type _count(InputIt first, InputIt last, const T& value, std::false_type)
+    {
+        return std::count(first, last, value);
+    }
+
+    template<typename InputIt, typename T>
+    typename std::iterator_traits<InputIt>::difference_type _count(InputIt first, InputIt last, const T& value, std::true_type)
+    {
+        const auto segs = first.getSegments(last);
+        return std::count(segs.first.begin(), segs.first.end(), value) + std::count(segs.second.begin(), segs.second.end(), value);
+    }
+
+    /// @brief Counts the elements equal to value in [first, last).
+    /// @details Linear complexity. For ring_buffer iterators the count runs on at most two contiguous segments.
+    template<typename InputIt, typename T>
+    typename std::iterator_traits<InputIt>::difference_type count(InputIt first, InputIt last, const T& value)
+    {
+        return _count(first, last, value, is_ring_buffer_iterator<InputIt>{});
+    }
+
+    template<typename ForwardIt, typename T>
+    void _fill(ForwardIt first, ForwardIt last, const T& value, std::false_type)
+    {
+        std::fill(first, last, value);
+    }
+
+    template<typename ForwardIt, typename T>
+    void _fill(ForwardIt first, ForwardIt last, const T& value, std::true_type)
+    {
+        const auto segs = first.getSegments(last);
+        std::fill(segs.first.begin(), segs.first.end(), value);
+        std::fill(segs.second.begin(), segs.second.end(), value);
+    }
+
+    /// @brief Assigns value to every element in [first, last).
+    /// @details Linear complexity. For ring_buffer iterators the assignment runs on at most two contiguous segments, which reaches memset for byte sized types.
+    template<typename ForwardIt, typename T>
+    void fill(ForwardIt first, ForwardIt last, const T& value)
+    {
+        _fill(first, last, value, is_ring_buffer_iterator<ForwardIt>{});
+    }
+
+    template<typename InputIt, typename UnaryFunction>
+    UnaryFunction _for_each(InputIt first, InputIt last, UnaryFunction f, std::false_type)
+    {
+        return std::for_each(first, last, std::move(f));
+    }
+
+    template<typename InputIt, typename UnaryFunction>
+    UnaryFunction _for_each(InputIt first, InputIt last, UnaryFunction f, std::true_type)
+    {
+        const auto segs = first.getSegments(last);
+        return std::for_each(segs.second.begin(), segs.second.end(), std::for_each(segs.first.begin(), segs.first.end(), std::move(f)));
+    }
+
+    /// @brief Applies f to every element in [first, last) in order.
+    /// @details Linear complexity. For ring_buffer iterators the loop runs on at most two contiguous segments.
+    template<typename InputIt, typename UnaryFunction>
+    UnaryFunction for_each(InputIt first, InputIt last, UnaryFunction f)
+    {
+        return _for_each(first, last, std::move(f), is_ring_buffer_iterator<InputIt>{});
+    }
+
+    template<typename InputIt, typename T>
+    T _accumulate(InputIt first, InputIt last, T init, std::false_type)
+    {
+        return std::accumulate(first, last, std::move(init));
+    }
+
+    template<typename InputIt, typename T>
+    T _accumulate(InputIt first, InputIt last, T init, std::true_type)
+    {
+        const auto segs = first.getSegments(last);
+        init = std::accumulate(segs.first.begin(), segs.first.end(), std::move(init));
+        return std::accumulate(segs.second.begin(), segs.second.end(), std::move(init));
+    }
+
+    /// @brief Sums init and the elements in [first, last) in order.
+    /// @details Linear complexity. For ring_buffer iterators the sum runs on at most two contiguous segments.
+    template<typename InputIt, typename T>
+    T accumulate(InputIt first, InputIt last, T init)
+    {
+        return _accumulate(first, last, std::move(init), is_ring_buffer_iterator<InputIt>{});
+    }
+
+    // Runs op(sourceBegin, sourceEnd, destination) on destination segments when the destination is a ring_buffer iterator and the source
+    // is a random access range. Otherwise op runs once on the whole range.
+    template<typename InputIt, typename OutputIt, typename Op>
+    OutputIt _toSegments(InputIt first, InputIt last, OutputIt dest, Op op, std::false_type)
+    {
+        return op(first, last, dest);
+    }
+
+    template<typename InputIt, typename OutputIt, typename Op>
+    OutputIt _toSegments(InputIt first, InputIt last, OutputIt dest, Op op, std::true_type)
+    {
+        const auto destEnd = dest + std::distance(first, last);
+        const auto segs = dest.getSegments(destEnd);
+        const auto mid = first + segs.first.size();
+
+        op(first, mid, segs.first.begin());
+        op(mid, last, segs.second.begin());
+        return destEnd;
+    }
+
+    template<typename InputIt, typename OutputIt, typename Op>
+    OutputIt _copySegments(InputIt first, InputIt last, OutputIt dest, Op op, std::false_type)
+    {
+        using split = std::integral_constant<bool, is_ring_buffer_iterator<OutputIt>::value && is_random_access<InputIt>::value>;
+        return _toSegments(first, last, dest, op, split{});
+    }
+
+    template<typename InputIt, typename OutputIt, typename Op>
+    OutputIt _copySegments(InputIt first, InputIt last, OutputIt dest, Op op, std::true_type)
+    {
+        using split = std::integral_constant<bool, is_ring_buffer_iterator<OutputIt>::value>;
+        const auto segs = first.getSegments(last);
+        dest = _toSegments(segs.first.begin(), segs.first.end(), dest, op, split{});
+        return _toSegments(segs.second.begin(), segs.second.end(), dest, op, split{});
+    }
+
+    /// @brief Copies [first, last) to the range beginning at dest.
+    /// @details Linear complexity. Both source and destination ring_buffer ranges are split into contiguous segments, so trivially copyable types are copied with memmove.
+    template<typename InputIt, typename OutputIt>
+    OutputIt copy(InputIt first, InputIt last, OutputIt dest)
+    {
+        return _copySegments(first, last, dest, [](auto b, auto e, auto d) { return std::copy(b, e, d); }, is_ring_buffer_iterator<InputIt>{});
+    }
+
+    /// @brief Applies op to every element in [first, last) and stores the results to the range beginning at dest.
+    /// @details Linear complexity. Both source and destination ring_buffer ranges are split into contiguous segments.
+    template<typename InputIt, typename OutputIt, typename UnaryOperation>
+    OutputIt transform(InputIt first, InputIt last, OutputIt dest, UnaryOperation op)
+    {
+        return _copySegments(first, last, dest, [&op](auto b, auto e, auto d) { return std::transform(b, e, d, op); }, is_ring_buffer_iterator<InputIt>{});
+    }
+
+    template<typename InputIt1, typename InputIt2>
+    bool _equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, std::false_type)
+    {
+        return std::equal(first1, last1, first2);
+    }
+
+    template<typename InputIt1, typename InputIt2>
+    bool _equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, std::true_type)
+    {
+        const auto segs = first2.getSegments(first2 + std::distance(first1, last1));
+        const auto mid1 = first1 + segs.first.size();
+        return std::equal(first1, mid1, segs.first.begin()) && std::equal(mid1, last1, segs.second.begin());
+    }
+
+    template<typename InputIt1, typename InputIt2>
+    bool _equalSegments(InputIt1 first1, InputIt1 last1, InputIt2 first2, std::false_type)
+    {
+        using split = std::integral_constant<bool, is_ring_buffer_iterator<InputIt2>::value && is_random_access<InputIt1>::value>;
+        return _equal(first1, last1, first2, split{});
+    }
+
+    template<typename InputIt1, typename InputIt2>
+    bool _equalSegments(InputIt1 first1, InputIt1 last1, InputIt2 first2, std::true_type)
+    {
+        using split = std::integral_constant<bool, is_ring_buffer_iterator<InputIt2>::value>;
+        const auto segs = first1.getSegments(last1);
+        if (!_equal(segs.first.begin(), segs.first.end(), first2, split{}))
+        {
+            return false;
+        }
+        std::advance(first2, segs.first.size());
+        return _equal(segs.second.begin(), segs.second.end(), first2, split{});
+    }
+
+    /// @brief Checks if [first1, last1) is equal to the range beginning at first2.
+    /// @details Linear complexity. Both ring_buffer ranges are split into contiguous segments.
+    template<typename InputIt1, typename InputIt2>
+    bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2)
+    {
+        return _equalSegments(first1, last1, first2, is_ring_buffer_iterator<InputIt1>{});
+    }
+}
+
+/// @brief Ring buffer which keeps its capacity at a power of two and wraps indices with a bitmask.
+/// @tparam T Type of the elements.
+/// @tparam Allocator Allocator used for (de)allocation and (de)construction. Defaults to std::allocator<T>
+template<typename T, typename Allocator = std::allocator<T>>
+using pow2_ring_buffer = ring_buffer<T, Allocator, pow2_capacity_policy>;
+
 #endif /*DYNAMIC_RINGBUFFER_HPP*/
@@ -0,0 +1,14 @@
+#include "ring_buffer.hpp"
+#include <array>
+#include <memory>
+
+// The buffers are allocated on the heap so that massif sees the buffer objects too.
+int main()
+{
+auto buffers = std::make_unique<std::array<ring_buffer<int>, 1000>>();
+
+    for(auto& v : *buffers)
+    {
+        v = ring_buffer<int>(64, 1);
+    }
+}
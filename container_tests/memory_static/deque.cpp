@@ -0,0 +1,14 @@
+#include <deque>
+#include <array>
+#include <memory>
+
+// The deques are allocated on the heap so that massif sees the deque objects too.
+int main()
+{
+auto deqs = std::make_unique<std::array<std::deque<int>, 1000>>();
+
+    for(auto& v : *deqs)
+    {
+        v = std::deque<int>(64, 1);
+    }
+}
@@ -0,0 +1,5301 @@
+#ifndef DYNAMIC_RINGBUFFER_HPP
+#define DYNAMIC_RINGBUFFER_HPP
+
+#include <memory>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <stdexcept>
+#include <cstring>
+#include <vector>
+#include <numeric>
+#include <iterator>
+#include <type_traits>
+#include <cstdlib>
+#include <new>
+#include <cstddef>
+
+namespace
+{
+    //Temporary object holder.
+    template<typename Alloc>
+    struct _alloc_temp
+    {
+        using value_type = typename Alloc::value_type;
+        using _traits = std::allocator_traits<Alloc>;
+
+        Alloc&  _alloc;
+
+        union
+        {
+            value_type _value;
+        };
+
+        value_type& _getValue() noexcept
+        {
+            return _value;
+        }
+
+        const value_type& _getValue() const noexcept
+        {
+            return _value;
+        }
+
+        template<typename... Args>
+        explicit _alloc_temp(Alloc& allocator, Args&&... args) noexcept(
+        noexcept(_traits::construct(_alloc, std::addressof(_getValue()), std::forward<Args>(args)...)))
+        : _alloc(allocator)
+        {
+            _traits::construct(_alloc, std::addressof(_getValue()), std::forward<Args>(args)...);
+        }
+
+        ~_alloc_temp() noexcept
+        {
+            _traits::destroy(_alloc, std::addressof(_getValue()));
+        }
+
+    };
+
+    // Forward iterator that repeats a single value, so that a value can be inserted with the functions taking a source range.
+    template<typename T>
+    struct _repeat_iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const T* _value;
+        difference_type _index;
+
+        reference operator*() const noexcept { return *_value; }
+        pointer operator->() const noexcept { return _value; }
+
+        _repeat_iterator& operator++() noexcept
+        {
+            ++_index;
+            return *this;
+        }
+
+        _repeat_iterator operator++(int) noexcept
+        {
+            auto temp = *this;
+            ++_index;
+            return temp;
+        }
+
+        bool operator==(const _repeat_iterator& rhs) const noexcept { return _index == rhs._index; }
+        bool operator!=(const _repeat_iterator& rhs) const noexcept { return _index != rhs._index; }
+    };
+
+    // Strategies used to relocate elements to newly allocated memory.
+    struct _relocate_memcpy_tag {};
+    struct _relocate_move_tag {};
+    struct _relocate_copy_tag {};
+
+    template<typename Alloc, typename = void>
+    struct _has_custom_construct : std::false_type {};
+
+    template<typename Alloc>
+    struct _has_custom_construct<Alloc, decltype(void(std::declval<Alloc&>().construct(std::declval<typename Alloc::value_type*>(), std::declval<typename Alloc::value_type&&>())))> : std::true_type {};
+
+    template<typename Alloc, typename = void>
+    struct _has_custom_destroy : std::false_type {};
+
+    template<typename Alloc>
+    struct _has_custom_destroy<Alloc, decltype(void(std::declval<Alloc&>().destroy(std::declval<typename Alloc::value_type*>())))> : std::true_type {};
+
+    // Elements may be relocated bitwise only if the allocator does not customize construction or destruction. std::allocator only forwards to placement new and destructor.
+    template<typename Alloc>
+    struct _has_default_construct : std::integral_constant<bool, !_has_custom_construct<Alloc>::value && !_has_custom_destroy<Alloc>::value> {};
+
+    template<typename T>
+    struct _has_default_construct<std::allocator<T>> : std::true_type {};
+
+    template<typename Alloc, typename = void>
+    struct _has_reallocate : std::false_type {};
+
+    template<typename Alloc>
+    struct _has_reallocate<Alloc, decltype(void(std::declval<Alloc&>().reallocate(std::declval<typename Alloc::value_type*>(), size_t(), size_t())))> : std::true_type {};
+}
+
+/// @brief Trait telling if objects of type T can be relocated to a new address by copying their bytes, without calling the move constructor and destructor.
+/// @details True for trivially copyable types. Specialize as std::true_type for types that do not depend on their own address (for example most handle types and std::unique_ptr like wrappers).
+template<typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+/// @brief Default capacity policy. Capacity is used as requested and physical indices are wrapped with modulo arithmetic.
+struct default_capacity_policy
+{
+    /// @brief Rounds a requested capacity to a capacity supported by the policy.
+    /// @param capacity Requested capacity.
+    /// @return Capacity to allocate.
+    static size_t round(size_t capacity) noexcept
+    {
+        return capacity;
+    }
+
+    /// @brief Wraps an index to the physical memory area.
+    /// @param index Index to wrap. Must be less than 2 * capacity.
+    /// @param capacity Capacity of the buffer.
+    static size_t wrap(size_t index, size_t capacity) noexcept
+    {
+        return index >= capacity ? index - capacity : index;
+    }
+
+    /// @brief Gets the index following index, wrapping around at the end of physical memory area.
+    static size_t next(size_t index, size_t capacity) noexcept
+    {
+        ++index;
+        if(index >= capacity)
+        {
+            index = 0;
+        }
+        return index;
+    }
+
+    /// @brief Gets the index preceding index, wrapping around at the beginning of physical memory area.
+    static size_t prev(size_t index, size_t capacity) noexcept
+    {
+        if(index == 0)
+        {
+            return capacity - 1;
+        }
+        return index - 1;
+    }
+
+    /// @brief Gets the amount of steps from index first to index last.
+    static size_t distance(size_t first, size_t last, size_t capacity) noexcept
+    {
+        if(last < first)
+        {
+            return last + capacity - first;
+        }
+        return last - first;
+    }
+};
+
+/// @brief Power-of-two capacity policy. Capacity is always rounded up to a power of two, which allows wrapping indices with a bitmask instead of a division.
+struct pow2_capacity_policy
+{
+    /// @brief Rounds a requested capacity up to the next power of two.
+    /// @param capacity Requested capacity.
+    /// @return Capacity to allocate. If the rounded value would overflow, capacity is returned as is and the allocation is left to fail.
+    static size_t round(size_t capacity) noexcept
+    {
+        size_t rounded = 1;
+        while (rounded < capacity && rounded != 0)
+        {
+            rounded <<= 1;
+        }
+        return rounded ? rounded : capacity;
+    }
+
+    /// @brief Wraps an index to the physical memory area.
+    static size_t wrap(size_t index, size_t capacity) noexcept
+    {
+        return index & (capacity - 1);
+    }
+
+    /// @brief Gets the index following index. Branch-free.
+    static size_t next(size_t index, size_t capacity) noexcept
+    {
+        return (index + 1) & (capacity - 1);
+    }
+
+    /// @brief Gets the index preceding index. Branch-free.
+    static size_t prev(size_t index, size_t capacity) noexcept
+    {
+        return (index - 1) & (capacity - 1);
+    }
+
+    /// @brief Gets the amount of steps from index first to index last. Branch-free.
+    static size_t distance(size_t first, size_t last, size_t capacity) noexcept
+    {
+        return (last - first) & (capacity - 1);
+    }
+};
+
+/// @brief Default growth policy. Capacity grows by a factor of 1.5.
+struct default_growth_policy
+{
+    /// @brief Gets the capacity to allocate when the buffer runs out of memory.
+    /// @param capacity Current capacity of the buffer.
+    /// @param required Minimum capacity needed for the operation that triggered the growth.
+    /// @param elementSize Size of an element in bytes.
+    /// @return New capacity, at least required.
+    static size_t grow(size_t capacity, size_t required, size_t /*elementSize*/) noexcept
+    {
+        return std::max(capacity + capacity / 2, required);
+    }
+};
+
+/// @brief Doubling growth policy. Reallocates less often than the default policy at the cost of more unused memory.
+struct double_growth_policy
+{
+    static size_t grow(size_t capacity, size_t required, size_t /*elementSize*/) noexcept
+    {
+        return std::max(capacity * 2, required);
+    }
+};
+
+/// @brief Power-of-two growth policy. Capacity grows to the next power of two that fits the required capacity.
+/// @note Pairs with pow2_capacity_policy, which rounds every allocation to a power of two anyway.
+struct pow2_growth_policy
+{
+    static size_t grow(size_t capacity, size_t required, size_t /*elementSize*/) noexcept
+    {
+        return pow2_capacity_policy::round(std::max(capacity + 1, required));
+    }
+};
+
+/// @brief Page growth policy. Capacity grows by a factor of 1.5 and is then rounded up so that the allocation fills whole pages.
+/// @tparam PageSize Size of a memory page in bytes.
+template<size_t PageSize = 4096>
+struct page_growth_policy
+{
+    static size_t grow(size_t capacity, size_t required, size_t elementSize) noexcept
+    {
+        const auto grown = std::max(capacity + capacity / 2, required);
+        const auto bytes = (grown * elementSize + PageSize - 1) / PageSize * PageSize;
+        return bytes / elementSize;
+    }
+};
+
+/// @brief Default overflow policy. The buffer grows when an element is added to a full buffer, as decided by the GrowthPolicy.
+struct grow_overflow_policy {};
+
+/// @brief Overflow policy for a bounded buffer. Pushing to a full buffer replaces the element at the opposite end in constant time without allocating,
+/// so push_back overwrites the oldest element. Operations that would need to grow the buffer in the middle throw std::length_error.
+/// @note The bound is set with reserve(). A buffer with capacity() n holds n elements.
+struct overwrite_overflow_policy {};
+
+/// @brief Overflow policy for a bounded buffer. Adding elements to a full buffer throws std::length_error and leaves the buffer unchanged.
+/// try_push_back and try_emplace_back report a full buffer by returning false instead.
+/// @note The bound is set with reserve(). A buffer with capacity() n holds n elements.
+struct reject_overflow_policy {};
+
+/// @brief Overflow policy that grows the buffer incrementally. Pushing to a full buffer allocates the grown memory but leaves the elements in the previous memory.
+/// Each following push and pop moves up to MovesPerOperation elements, so no single push relocates the whole buffer. Indexing, front() and back() find elements in either memory block.
+/// @details Other operations, such as iterating, inserting and reserve(), first finish the migration. finish_growth() finishes it explicitly.
+/// @note value_type must be nothrow move constructible. While a migration is in progress, push and pop invalidate pointers and references to any element.
+/// @tparam MovesPerOperation Amount of elements moved per push or pop. With the default growth policy a value of 2 or more finishes the migration before the buffer is full again.
+template<size_t MovesPerOperation = 4>
+struct incremental_overflow_policy
+{
+    static_assert(MovesPerOperation > 0, "incremental_overflow_policy must move at least one element per operation.");
+};
+
+/// @brief Tag selecting default-initialization of new elements instead of value-initialization.
+/// @details With std::allocator, trivially default constructible elements are left uninitialized like in new T[n], so no time is spent zeroing memory that is about to be overwritten.
+struct default_init_t {};
+
+/// @brief Instance of default_init_t for overload selection, e.g. ring_buffer<char> buf(4096, default_init).
+constexpr default_init_t default_init{};
+
+/// @brief Allocator backed by malloc, realloc and free.
+/// @details Provides the optional reallocate extension. ring_buffer uses it to grow the buffer in place when elements are trivially relocatable.
+/// For large blocks realloc can grow into free address space after the block (mremap on Linux), so a multi gigabyte buffer does not need to be copied.
+/// @tparam T Type of the elements. Must not be over-aligned.
+template<typename T>
+struct realloc_allocator
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t), "realloc_allocator does not support over-aligned types.");
+
+    using value_type = T;
+
+    realloc_allocator() noexcept = default;
+
+    template<typename U>
+    realloc_allocator(const realloc_allocator<U>&) noexcept {}
+
+    T* allocate(size_t n)
+    {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        auto p = std::malloc(n * sizeof(T));
+        if (!p)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t) noexcept
+    {
+        std::free(p);
+    }
+
+    /// @brief Resizes a block, in place if possible. Contents are preserved bytewise.
+    /// @param p Pointer to a block from allocate or reallocate.
+    /// @param oldCapacity Amount of elements in the block.
+    /// @param newCapacity Requested amount of elements.
+    /// @return Pointer to the resized block, or null pointer if the block could not be resized. On failure p is left untouched.
+    T* reallocate(T* p, size_t /*oldCapacity*/, size_t newCapacity) noexcept
+    {
+        if (newCapacity > std::numeric_limits<size_t>::max() / sizeof(T))
+        {
+            return nullptr;
+        }
+        return static_cast<T*>(std::realloc(p, newCapacity * sizeof(T)));
+    }
+
+    friend bool operator==(const realloc_allocator&, const realloc_allocator&) noexcept { return true; }
+    friend bool operator!=(const realloc_allocator&, const realloc_allocator&) noexcept { return false; }
+};
+
+// Stores the allocator. Stateless allocators are stored as a base class, so that they take no space in the buffer (empty base optimization).
+    template<typename Alloc, bool = std::is_empty<Alloc>::value && !std::is_final<Alloc>::value>
+    struct _allocator_storage : private Alloc
+    {
+        explicit _allocator_storage(const Alloc& alloc) : Alloc(alloc) {}
+
+        Alloc& _allocator() noexcept { return *this; }
+        const Alloc& _allocator() const noexcept { return *this; }
+    };
+
+    template<typename Alloc>
+    struct _allocator_storage<Alloc, false>
+    {
+        explicit _allocator_storage(const Alloc& alloc) : m_allocator(alloc) {}
+
+        Alloc& _allocator() noexcept { return m_allocator; }
+        const Alloc& _allocator() const noexcept { return m_allocator; }
+
+        Alloc m_allocator;  /*!< Allocator used to allocate/deallocate and construct/destruct elements.*/
+    };
+
+    // Amount of elements incremental_overflow_policy moves per operation, zero for the other overflow policies.
+    template<typename Policy>
+    struct _migration_steps : std::integral_constant<size_t, 0> {};
+
+    template<size_t MovesPerOperation>
+    struct _migration_steps<incremental_overflow_policy<MovesPerOperation>> : std::integral_constant<size_t, MovesPerOperation> {};
+
+// Holds the previous memory block while incremental_overflow_policy moves its elements to the grown memory. Empty for the other overflow policies.
+    template<typename T, bool Incremental>
+    struct _migration_storage
+    {
+        void _swapMigration(_migration_storage&) noexcept {}
+    };
+
+    template<typename T>
+    struct _migration_storage<T, true>
+    {
+        _migration_storage() noexcept = default;
+
+        _migration_storage(_migration_storage&& other) noexcept
+            : m_oldData(std::exchange(other.m_oldData, nullptr)), m_oldCapacity(other.m_oldCapacity), m_oldTail(other.m_oldTail),
+              m_pendingBegin(std::exchange(other.m_pendingBegin, 0)), m_pendingEnd(std::exchange(other.m_pendingEnd, 0))
+        {
+        }
+
+        _migration_storage& operator=(const _migration_storage&) = delete;
+
+        void _swapMigration(_migration_storage& other) noexcept
+        {
+            std::swap(m_oldData, other.m_oldData);
+            std::swap(m_oldCapacity, other.m_oldCapacity);
+            std::swap(m_oldTail, other.m_oldTail);
+            std::swap(m_pendingBegin, other.m_pendingBegin);
+            std::swap(m_pendingEnd, other.m_pendingEnd);
+        }
+
+        mutable T* m_oldData = nullptr;  /*!< Previous memory block. Null if no migration is in progress.*/
+
+        size_t m_oldCapacity = 0;  /*!< Capacity of the previous memory block.*/
+
+        size_t m_oldTail = 0;  /*!< Physical index of the first element in the previous memory block when the migration started.*/
+
+        mutable size_t m_pendingBegin = 0;  /*!< Elements of the slots [m_pendingBegin, m_pendingEnd) of the new memory still live in the previous memory block.*/
+
+        size_t m_pendingEnd = 0;
+    };
+
+//Base class that wraps memory allocation into an initialization (RAII).
+    template<typename T, typename Allocator = std::allocator<T>, typename CapacityPolicy = default_capacity_policy>
+    struct ring_buffer_base : _allocator_storage<Allocator> {
+
+        using size_type = std::size_t;
+        using allocator_type = Allocator;
+        using alloc_traits = std::allocator_traits<allocator_type>;
+        using storage = _allocator_storage<Allocator>;
+
+        size_type m_capacity;  /*!< Capacity of the buffer. How many elements of type T the buffer has currently allocated memory for.*/
+
+        T* m_data;  /*!< Pointer to allocated memory. Null if the capacity is zero.*/
+
+        /// @note Capacity is rounded by the CapacityPolicy, so the allocated capacity may be larger than requested. A capacity of zero allocates nothing.
+        ring_buffer_base(const Allocator& alloc, size_type capacity)
+            : storage(alloc), m_capacity(capacity == 0 ? 0 : CapacityPolicy::round(capacity)), m_data(m_capacity == 0 ? nullptr : alloc_traits::allocate(storage::_allocator(), m_capacity))
+        {
+        }
+
+        ring_buffer_base(const ring_buffer_base&) = delete;
+        ring_buffer_base& operator=(const ring_buffer_base&) = delete;
+
+        ring_buffer_base(ring_buffer_base&& other) noexcept : storage(std::move(other._allocator())), m_capacity(std::exchange(other.m_capacity, 0)), m_data(std::exchange(other.m_data, nullptr))
+        {
+        }
+
+        ring_buffer_base& operator=(ring_buffer_base&& other) noexcept
+        {
+            swap(*this,other);
+            return *this;
+        }
+
+        void swap(ring_buffer_base& left, ring_buffer_base& right) noexcept
+        {
+            std::swap(left._allocator(), right._allocator());
+            std::swap(left.m_data, right.m_data);
+            std::swap(left.m_capacity, right.m_capacity);
+        }
+
+        ~ring_buffer_base()
+        {
+            if (m_data)
+            {
+                alloc_traits::deallocate(storage::_allocator(), m_data, m_capacity);
+            }
+        }
+    };
+
+/// @brief Non-owning view to a contiguous memory segment of a ring_buffer.
+/// @tparam T Type of the elements, const qualified for read-only segments.
+template<typename T>
+class ring_buffer_span
+{
+public:
+    ring_buffer_span() noexcept : m_data(nullptr), m_size(0) {}
+
+    ring_buffer_span(T* data, size_t size) noexcept : m_data(data), m_size(size) {}
+
+    /// @brief Gets a pointer to the first element of the segment.
+    T* data() const noexcept { return m_data; }
+
+    /// @brief Gets the amount of elements in the segment.
+    size_t size() const noexcept { return m_size; }
+
+    /// @brief Checks if the segment is empty.
+    bool empty() const noexcept { return m_size == 0; }
+
+    T* begin() const noexcept { return m_data; }
+
+    T* end() const noexcept { return m_data + m_size; }
+
+private:
+    T* m_data;
+    size_t m_size;
+};
+
+// Forward declaration of _rBuf_const_iterator.
+template<class _rBuf>
+class _rBuf_const_iterator;
+
+/// @brief Dynamic Ringbuffer is a dynamically growing circular AllocatorAware std::container with support for queue, stack and priority queue adaptor functionality.
+/// @tparam T Type of the elements.
+/// @tparam Allocator Allocator used for (de)allocation and (de)construction. Defaults to std::allocator<T>. If the allocator provides
+/// T* reallocate(T* p, size_t oldCapacity, size_t newCapacity) that returns a null pointer instead of throwing on failure (see realloc_allocator)
+/// and T is trivially relocatable, the buffer grows in place.
+/// @tparam CapacityPolicy Policy that rounds capacity and wraps physical indices. Defaults to default_capacity_policy, pow2_capacity_policy enables mask based indexing.
+/// @tparam GrowthPolicy Policy that decides the new capacity when the buffer runs out of memory. Defaults to default_growth_policy (1.5x).
+/// @tparam OverflowPolicy Policy that decides what happens when the buffer is full. Defaults to grow_overflow_policy, overwrite_overflow_policy and
+/// reject_overflow_policy keep the buffer at the capacity set with reserve(), incremental_overflow_policy spreads growing over the following operations.
+template<typename T, typename Allocator = std::allocator<T>, typename CapacityPolicy = default_capacity_policy, typename GrowthPolicy = default_growth_policy, typename OverflowPolicy = grow_overflow_policy> 
+class ring_buffer : private ring_buffer_base<T,Allocator,CapacityPolicy>, private _migration_storage<T, _migration_steps<OverflowPolicy>::value != 0>
+{
+
+public:
+
+    using base = typename ring_buffer::ring_buffer_base;
+    using capacity_policy = CapacityPolicy;
+    using growth_policy = GrowthPolicy;
+    using overflow_policy = OverflowPolicy;
+
+    using size_type = typename base::size_type;
+    using allocator_type = typename base::allocator_type;
+    using alloc_traits = typename base::alloc_traits;
+
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Custom iterator class.
+    /// @tparam _rBuf ring_buffer class type.
+    /// @note The iterator holds a raw pointer to the element and the parent container. Dereferencing is a plain pointer access and
+    /// incrementing is a pointer bump with a check for the physical wrap boundary. The past-the-last iterator is represented by a null pointer.
+    template<class _rBuf>
+    class _rBuf_const_iterator
+    {
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+
+        using value_type = typename _rBuf::value_type;
+        using difference_type = typename _rBuf::difference_type;
+        using pointer = typename _rBuf::const_pointer;
+        using reference = const value_type&;
+
+    public:
+        _rBuf_const_iterator() : m_container(nullptr), m_ptr(nullptr) {}
+
+        /// @brief Constructor.
+        /// @param index Index representing the logical element of the buffer where iterator points to.
+        explicit _rBuf_const_iterator(const _rBuf* container, difference_type index) : m_container(container), m_ptr(container->_pointerAt(index)) {}
+
+        /// @brief Arrow operator.
+        /// @return pointer.
+        /// @details Constant complexity.
+        pointer operator->() const
+        {
+            return m_ptr;
+        }
+
+        /// @brief Prefix increment
+        /// @note If the iterator is incremented over the end() iterator leads to invalid iterator (dereferencing is undefined behaviour).
+        /// @details Constant complexity.
+        _rBuf_const_iterator& operator++() noexcept
+        {
+            m_ptr = m_container->_next(m_ptr);
+
+            return (*this);
+        }
+
+        /// @brief Postfix increment
+        /// @param  int empty parameter to guide overload resolution.
+        /// @note If the iterator is incremented over the end() iterator leads to invalid iterator (dereferencing is undefined behaviour).
+        /// @details Constant complexity.
+        _rBuf_const_iterator operator++(int)
+        {
+            auto temp(*this);
+            m_ptr = m_container->_next(m_ptr);
+
+            return temp;
+        }
+
+        /// @brief Prefix decrement.
+        /// @note Decrementing the iterator past begin() leads to invalid iterator (dereferencing is undefined behaviour).
+        /// @details Constant complexity.
+        _rBuf_const_iterator& operator--()
+        {
+            m_ptr = m_container->_prev(m_ptr);
+            return(*this);
+        }
+
+        /// @brief Postfix decrement
+        /// @param  int empty parameter to guide overload resolution.
+        /// @note Decrementing iterator past begin() results in undefined behaviour.
+        /// @details Constant complexity.
+        _rBuf_const_iterator operator--(int)
+        {
+            auto temp(*this);
+            m_ptr = m_container->_prev(m_ptr);
+            return temp;
+        }
+
+        /// @brief Moves iterator.
+        /// @param offset Amount of elements to move. Negative values move iterator backwards.
+        /// @note If offset is such that the iterator is beyond end() or begin(), the return iterator is invalid (dereferencing it is undefined behaviour).
+        /// @details Constant complexity.
+        _rBuf_const_iterator& operator+=(difference_type offset) noexcept
+        {
+            m_ptr = m_container->_pointerAt(getIndex() + offset);
+            return (*this);
+        }
+
+        /// @brief Move iterator forward by specified amount.
+        /// @param movement Amount of elements to move the iterator.
+        /// @note If offset is such that the iterator is beyond end() or begin(), the return iterator is invalid (dereferencing it is undefined behaviour).
+        /// @details Constant complexity.
+        _rBuf_const_iterator operator+(const difference_type offset) const
+        {
+            _rBuf_const_iterator temp(*this);
+            return (temp += offset);
+        }
+
+        /// @brief Addition operator with the offset at the beginning of the operation.
+        /// @param offset The number of positions to move the iterator forward.
+        /// @param iter Base iterator to what the offset is added to.
+        /// @note If offset is such that the iterator is beyond end() or begin(), the return iterator is invalid (dereferencing it is undefined behaviour).
+        /// @details Constant complexity.
+        friend _rBuf_const_iterator operator+(const difference_type offset, _rBuf_const_iterator iter)
+        {
+            auto temp = iter;
+            temp += offset;
+            return temp;
+        }
+
+        /// @brief Returns an iterator that points to an element, which is the current element decremented by the given offset.
+        /// @param offset The number of positions to move the iterator backward.
+        /// @return An iterator pointing to the element that is offset positions before the current element.
+        /// @details Constant complexity.
+        _rBuf_const_iterator& operator-=(const difference_type offset) noexcept
+        {
+            return (*this += -offset);
+        }
+
+        /// @brief Returns an iterator that points to an element, which is the current element decremented by the given offset.
+        /// @param offset The number of positions to move the iterator backward.
+        /// @return An iterator pointing to the element that is offset positions before the current element.
+        /// @note If offset is such that the index of the iterator is beyond end() or begin(), the return iterator is invalid (dereferencing it is undefined behaviour).
+        /// @details Constant complexity.
+        _rBuf_const_iterator operator-(const difference_type offset) const
+        {
+            _rBuf_const_iterator temp(*this);
+            return (temp -= offset);
+        }
+
+        /// @brief Gets distance between two iterators.
+        /// @param iterator Iterator to get distance to.
+        /// @return Amount of elements between the iterators.
+        /// @details Constant complexity.
+        difference_type operator-(const _rBuf_const_iterator& other) const noexcept
+        {
+            return (getIndex() - other.getIndex());
+        }
+
+        /// @brief Index operator.
+        /// @param offset The offset from iterator.
+        /// @return Return reference to element pointed by the iterator with offset.
+        /// @note If offset is such that the iterator is beyond end() or begin() this function has undefined behaviour.
+        /// @details Constant complexity.
+        reference operator[](const difference_type offset) const noexcept
+        {
+            return m_container->operator[](getIndex() + offset);
+        }
+
+        /// @brief Comparison operator== overload
+        /// @param other iterator to compare
+        /// @return True if iterators point to same element in same container.
+        /// @details Constant complexity.
+        bool operator==(const _rBuf_const_iterator& other) const noexcept
+        {
+            return (m_ptr == other.m_ptr) && (m_container == other.m_container);
+        }
+
+        /// @brief Comparison operator != overload
+        /// @param other iterator to compare
+        /// @return ture if underlying pointers are not the same
+        /// @details Constant complexity.
+        bool operator!=(const _rBuf_const_iterator& other) const noexcept
+        {
+            return !(m_ptr == other.m_ptr && m_container == other.m_container);
+        }
+
+        /// @brief Comparison operator < overload
+        /// @param other iterator to compare against.
+        /// @return True if other is larger.
+        /// @note Comparing to an iterator from another container is undefined.
+        /// @details Constant complexity.
+        bool operator<(const _rBuf_const_iterator& other) const noexcept
+        {
+            return (getIndex() < other.getIndex());
+        }
+
+        /// @brief Comparison operator > overload
+        /// @param other iterator to compare against.
+        /// @return True if other is smaller.
+        /// @note Comparing to an iterator from another container is undefined.
+        /// @details Constant complexity.
+        bool operator>(const _rBuf_const_iterator& other) const noexcept
+        {
+            return (other.getIndex() < getIndex());
+        }
+
+        /// @brief Less or equal operator.
+        /// @param other Other iterator to compare against.
+        /// @return Returns true if index of this is less or equal than other's. Otherwise false.
+        /// @note Comparing to an iterator from another container is undefined.
+        /// @details Constant complexity.
+        bool operator<=(const _rBuf_const_iterator& other) const noexcept
+        {
+            return (!(other.getIndex() < getIndex()));
+        }
+
+        /// @brief Greater or equal than operator.
+        /// @param other Iterator to compare against.
+        /// @return Returns true if this's index is greater than or equal to other.
+        /// @note Comparing to an iterator from another container is undefined.
+        /// @details Constant complexity.
+        bool operator>=(const _rBuf_const_iterator& other) const noexcept
+        {
+            return (!(getIndex() < other.getIndex()));
+        }
+
+        /// @brief Custom assingment operator overload.
+        /// @param index Logical index of the element which point to.
+        /// @details Constant complexity.
+        _rBuf_const_iterator& operator=(const size_t index) noexcept
+        {
+            m_ptr = m_container->_pointerAt(index);
+            return (*this);
+        };
+
+        /// @brief Dereference operator.
+        /// @return Object pointed by iterator.
+        /// @details Constant complexity.
+        reference operator*() const noexcept
+        {
+            return *m_ptr;
+
+        }
+
+        /// @brief Returns the logical index of the element the iterator is pointing to.
+        /// @details Constant complexity.
+        difference_type getIndex() const noexcept
+        {
+            return m_container->_indexOf(m_ptr);
+        }
+
+        /// @brief Splits the range [*this, last) into contiguous memory segments.
+        /// @param last Iterator past the last element of the range. Must be reachable from *this in the same container.
+        /// @return Pair of read-only segments in logical order. The second segment is empty unless the range wraps around the end of the allocated memory.
+        /// @details Constant complexity.
+        std::pair<ring_buffer_span<const value_type>, ring_buffer_span<const value_type>> getSegments(const _rBuf_const_iterator& last) const noexcept
+        {
+            const auto segs = m_container->_segments(m_ptr, last.m_ptr);
+            return {{segs.first.data(), segs.first.size()}, {segs.second.data(), segs.second.size()}};
+        }
+
+        // Marks the type as a ring_buffer iterator for the segment-aware algorithms.
+        using container_type = _rBuf;
+
+    protected:
+        // The parent container.
+        const _rBuf* m_container;
+
+        // Pointer to the element in physical memory. Logical index 0 is the first element in the buffer and last is size - 1,
+        // past-the-last element is represented by a null pointer since its physical address could equal to the first element.
+        typename _rBuf::pointer m_ptr;
+    };
+
+    /// @brief Custom iterator class.
+    /// @tparam T Type of the element what iterator points to.
+    template<class _rBuf>
+    class _rBuf_iterator : public _rBuf_const_iterator<_rBuf>
+    {
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+
+        using c_iterator = _rBuf_const_iterator<_rBuf>;
+        using value_type = typename _rBuf::value_type;
+        using difference_type = typename _rBuf::difference_type;
+        using pointer = typename _rBuf::pointer;
+        using reference = value_type&;
+
+    public:
+
+        /// @brief Default constructor
+        _rBuf_iterator() = default;
+
+        /// @brief Constructor.
+        /// @param container Pointer to the ring_buffer element which owns this iterator.
+        /// @param index Index pointing to the logical element of the ring_buffer.
+        /// @details Constant complexity.
+        explicit _rBuf_iterator(_rBuf* container, size_type index) : c_iterator(container, index) {}
+
+        /// @brief Dereference operator
+        /// @return  Returns the object the iterator is currently pointing to.
+        /// @details Constant complexity.
+        reference operator*() const noexcept
+        {
+            return *c_iterator::m_ptr;
+        }
+
+        /// @brief Arrow operator. 
+        /// @return Returns a pointer to the object the iterator is currently pointing to.
+        /// @details Constant complexity.
+        pointer operator->() const noexcept
+        {
+            return c_iterator::m_ptr;
+        }
+
+        /// @brief Prefix increment.
+        /// @note Incrementing the iterator over the end() iterator leads to invalid iterator (dereferencing is undefined behaviour).
+        /// @details Constant complexity.
+        _rBuf_iterator& operator++() noexcept
+        {
+            c_iterator::operator++();
+            return (*this);
+        }
+
+        /// @brief Postfix increment
+        /// @param  int empty parameter to guide overload resolution.
+        /// @note Incrementing the iterator over the end() iterator leads to invalid iterator (dereferencing is undefined behaviour).
+        /// @details Constant complexity.
+        _rBuf_iterator operator++(int)
+        {
+            auto temp(*this);
+            c_iterator::operator++();
+            return temp;
+        }
+
+        /// @brief Prefix decrement
+        /// @Details Constant complexity.
+        /// @note Decrementing the iterator past begin() leads to invalid iterator (dereferencing is undefined behaviour).
+        _rBuf_iterator& operator--() noexcept
+        {
+            c_iterator::operator--();
+            return(*this);
+        }
+
+        /// @brief Postfix decrement
+        /// @param  int empty parameter to guide overload resolution.
+        /// @details Constant complexity.
+        /// @note Decrementing the iterator past begin() leads to invalid iterator (dereferencing is undefined behaviour).
+        _rBuf_iterator operator--(int)
+        {
+            auto temp(*this);
+            c_iterator::operator--();
+            return temp;
+        }
+
+        /// @brief Moves iterator forward.
+        /// @param offset Amount of elements to move.
+        /// @note Moving the iterator beyond begin() or end() makes the iterator point to an invalid element (dereferencing is undefined behaviour).
+        /// @details Constant complexity.
+        _rBuf_iterator& operator+=(difference_type offset) noexcept
+        {
+            c_iterator::operator+=(offset);
+            return (*this);
+        }
+
+        /// @brief Create a temporary iterator that has been moved forward by specified amount.
+        /// @param offset Amount of elements to move the iterator.
+        /// @details Constant complexity.
+        _rBuf_iterator operator+(const difference_type offset) const
+        {
+            _rBuf_iterator temp(*this);
+            return (temp += offset);
+        }
+
+        /// @brief Friend operator+. Creates a copy of an iterator which has been moved by given amount.
+        /// @param offset Amount of elements to move the iterator. 
+        /// @param iter Reference to base iterator.
+        /// @note Enables (n + a) expression, where n is a constant and a is iterator type.
+        /// @details Constant complexity.
+        friend _rBuf_iterator operator+(const difference_type offset, const _rBuf_iterator& iter)
+        {
+            auto temp = iter;
+            temp += offset;
+            return temp;
+        }
+
+        /// @brief Decrement this iterator by offset.
+        /// @param offset The number of positions to move the iterator backward.
+        /// @return An iterator pointing to the element that is offset positions before the current element.
+        /// @details Constant complexity.
+        _rBuf_iterator& operator-=(const difference_type offset) noexcept
+        {
+            return (*this += -offset);
+        }
+
+        /// @brief Get iterator decremented by offset.
+        /// @param offset Signed amount to decrement from the iterator index.
+        /// @return An iterator pointing to an element that points to *this - offset.
+        /// @note If offset is such that the index of the iterator is beyond end() or begin(), the return iterator is invalid (dereferencing it is undefined behaviour).
+        /// @details Constant complexity.
+        _rBuf_iterator operator-(const difference_type offset) const
+        {
+            _rBuf_iterator temp(*this);
+            return (temp -= offset);
+        }
+
+        /// @brief Decrement operator between two iterators.
+        /// @param other Other iterator.
+        /// @return Return the difference between the elements to what the iterators point to.
+        /// @details Constant complexity.
+        difference_type operator-(const _rBuf_iterator& other) const noexcept
+        {
+            return (c_iterator::getIndex() - other.c_iterator::getIndex());
+        }
+
+        /// @brief Index operator.
+        /// @param offset Signed offset from iterator index.
+        /// @return Return object pointer by the iterator with an offset.
+        /// @note If offset is such that the iterator is beyond end() or begin() this function has undefined behaviour.
+        /// @details Constant complexity.
+        reference operator[](const difference_type offset) const noexcept
+        {
+            return const_cast<reference>(c_iterator::operator[](offset));
+        }
+
+        /// @brief Comparison operator < overload.
+        /// @param other iterator to compare.
+        /// @return true if others index is larger.
+        /// @details Constant complexity.
+        bool operator<(const _rBuf_iterator& other) const noexcept
+        {
+            return (c_iterator::getIndex() < other.c_iterator::getIndex());
+        }
+
+        /// @brief Comparison operator > overload.
+        /// @param other iterator to compare against.
+        /// @return True if others index is smaller.
+        /// @details Constant complexity.
+        bool operator>(const _rBuf_iterator& other) const noexcept
+        {
+            return (c_iterator::getIndex() > other.c_iterator::getIndex());
+        }
+
+        /// @brief Comparison <= overload.
+        /// @param other Other iterator to compare against.
+        /// @return True if other points to logically smaller or the same indexed element.
+        /// @details Constant complexity.
+        bool operator<=(const _rBuf_iterator& other) const noexcept
+        {
+            return (c_iterator::getIndex() <= other.c_iterator::getIndex());
+        }
+
+        /// @brief Comparison >= overload.
+        /// @param other Other iterator to compare against.
+        /// @return True if other points to logically larger or same indexed element.
+        /// @details Constant complexity.
+        bool operator>=(const _rBuf_iterator& other) const noexcept
+        {
+            return (c_iterator::getIndex() >= other.c_iterator::getIndex());
+        }
+
+        /// @brief Custom assingment operator overload.
+        /// @param index Logical index of the element to set the iterator to.
+        /// @note Undefined behaviour for negative index.
+        /// @details Constant complexity.
+        _rBuf_iterator& operator=(const size_t index) noexcept
+        {
+            c_iterator::operator=(index);
+            return (*this);
+        };
+
+        /// @brief Index getter.
+        /// @return Returns the index of the element this iterator is pointing to.
+        /// @details Constant complexity.
+        difference_type getIndex() const noexcept
+        {
+            return c_iterator::getIndex();
+        }
+
+        /// @brief Splits the range [*this, last) into contiguous memory segments.
+        /// @param last Iterator past the last element of the range. Must be reachable from *this in the same container.
+        /// @return Pair of segments in logical order. The second segment is empty unless the range wraps around the end of the allocated memory.
+        /// @details Constant complexity.
+        std::pair<ring_buffer_span<value_type>, ring_buffer_span<value_type>> getSegments(const _rBuf_iterator& last) const noexcept
+        {
+            return c_iterator::m_container->_segments(c_iterator::m_ptr, last.m_ptr);
+        }
+    };
+
+
+    using iterator = _rBuf_iterator<ring_buffer>;
+    using const_iterator = _rBuf_const_iterator<ring_buffer>;
+
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    using span = ring_buffer_span<value_type>;
+    using const_span = ring_buffer_span<const value_type>;
+
+    /// @brief Memory block handed over by release() and taken over by adopt(). The elements [data, data + size) are constructed and the rest of the memory is uninitialized.
+    /// @details The block is allocated and deallocated with get_allocator() (or an allocator that compares equal to it) as capacity elements.
+    struct raw_storage
+    {
+        pointer data;  /*!< Pointer to the memory block. Null if capacity is zero.*/
+
+        size_type size;  /*!< Amount of constructed elements at the beginning of the block.*/
+
+        size_type capacity;  /*!< Amount of elements the block was allocated for.*/
+    };
+
+    /// @brief Default constructor. No memory is allocated until the first element is added.
+    /// @post this->empty() == true and capacity() == 0.
+    /// @details Constant complexity.
+    ring_buffer() noexcept(noexcept(allocator_type())) : ring_buffer(allocator_type())
+    {
+    }
+
+    /// @brief Constructs the container with a custom allocator. No memory is allocated until the first element is added.
+    /// @param alloc Custom allocator for the buffer.
+    /// @post this->empty() == true and capacity() == 0.
+    /// @details Constant complexity.
+    explicit ring_buffer(const allocator_type& alloc) noexcept : base(alloc, 0), m_size(0), m_tailIndex(0)
+    {
+    }
+
+    /// @brief Constructs the buffer to a given size with given values and optionally a custom allocator.
+    /// @param size Amount of elements to be initialized in the buffer.
+    /// @param val Reference to a value which the elements are initialized to.
+    /// @param alloc Custom allocator.
+    /// @pre T needs to satisfy CopyInsertable.
+    /// @post std::distance(begin(), end()) == size().
+    /// @note Allocates memory for exactly count elements, or nothing if count is zero.
+    /// @throw Can throw std::bad_alloc if there is not enough memory available for allocation, or some exception from T's constructor.
+    /// @exception If any exception is thrown the buffer will be in a valid but unexpected state. (Basic exception guarantee).
+    /// @details Linear complexity in relation to amount of constructed elements (O(n)).
+    ring_buffer(size_type count, const_reference val, const allocator_type& alloc = allocator_type()) : base(alloc, count), m_size(count), m_tailIndex(0)
+    {
+        _fillSegments(_range(0, count), val);
+    }
+    
+    /// @brief Custom constructor. Initializes a buffer with count amount of default constructed value_type elements.
+    /// @param count amount of default constructed value_type elements.
+    /// @pre T must satisfy DefaultInsertable.
+    /// @throw Can throw std::bad_alloc if there is not enough memory available for allocation, or some exception from T's constructor.
+    /// @exception If any exception is thrown the buffer will be in a valid but unexpected state. (Basic exception guarantee).
+    /// @details Linear complexity in relation to count (O(n)).
+    explicit ring_buffer(size_type count, const allocator_type& alloc = allocator_type()) : base(alloc, count), m_size(count), m_tailIndex(0)
+    {
+        _fillSegments(_range(0, count));
+    }
+
+    /// @brief Custom constructor. Initializes a buffer with count amount of default-initialized value_type elements.
+    /// @param count amount of default-initialized value_type elements.
+    /// @pre T must satisfy DefaultInsertable.
+    /// @note Trivially default constructible elements have indeterminate values if the allocator does not customize construction.
+    /// @throw Can throw std::bad_alloc if there is not enough memory available for allocation, or some exception from T's constructor.
+    /// @exception If any exception is thrown no memory is leaked. (Strong exception guarantee).
+    /// @details Linear complexity in relation to count (O(n)), constant if elements are left uninitialized.
+    ring_buffer(size_type count, default_init_t, const allocator_type& alloc = allocator_type()) : base(alloc, count), m_size(count), m_tailIndex(0)
+    {
+        _fillSegments(_range(0, count), default_init);
+    }
+
+    /// @brief Construct the buffer from range [begin,end).
+    /// @param beginIt Iterator to first element of range.
+    /// @param endIt Iterator pointing to past-the-last element of range.
+    /// @pre valye_type must satisfy CopyInsertable. InputIt must be deferencable to value_type, and incrementing rangeBegin (repeatedly) must reach rangeEnd. Otherwise behaviour is undefined.
+    /// @throw Can throw std::bad_alloc, or something from T's CopyConstructor if not NoThrowCopyConstructible.
+    /// @exception If any exception is thrown no memory is leaked and program remains in a valid state. (Basic exception guarantee).
+    /// @details Linear complexity in relation to the size of the range (O(n)).
+    /// @note Behavior is undefined if elements in range are not valid.
+    template<typename InputIt,typename = std::enable_if_t<std::is_convertible<typename std::iterator_traits<InputIt>::value_type,value_type>::value>>
+    ring_buffer(InputIt beginIt, InputIt endIt, const allocator_type& alloc = allocator_type())
+        : base(alloc, std::distance<InputIt>(beginIt,endIt)), m_size(std::distance<InputIt>(beginIt, endIt)), m_tailIndex(0)
+    {
+        _constructSegments(_range(0, m_size), beginIt);
+    }
+
+    /// @brief Initializer list contructor.
+    /// @param init Initializer list to initialize the buffer from.
+    /// @pre T must satisfy CopyInsertable.
+    /// @throw Can throw std::bad_alloc, or something from T's CopyConstructor if not NoThrowCopyConstructible.
+    /// @exception If any exception is thrown no memory is leaked and program remains in a valid state. (Basic exception guarantee).
+    /// @details Linear complexity in relation to initializer list size (O(n)).
+    ring_buffer(std::initializer_list<T> init) : ring_buffer(init.begin(),init.end())
+    {
+    }
+
+    /// @brief Copy constructor.
+    /// @param rhs Reference to a RingBuffer to create a copy from.
+    /// @pre T must meet CopyInsertable.
+    /// @post this == ring_buffer(rhs).
+    /// @throw Can throw std::bad_alloc, or something from T's CopyConstructor if not NoThrowCopyConstructible.
+    /// @except If any exception is thrown, invariants are preserved.(Basic Exception Guarantee).
+    /// @details Linear complexity in relation to buffer size.
+    ring_buffer(const ring_buffer& rhs) 
+    : base(alloc_traits::select_on_container_copy_construction(rhs._allocator()), rhs.capacity()), migration(), m_size(rhs.size()), m_tailIndex(0)
+    {
+        const auto segs = rhs.segments();
+        _constructFrom(segs.first.data(), segs.first.size(), segs.second.data(), segs.second.size());
+    }
+
+    /// @brief Copy constructor with custom allocator.
+    /// @param rhs Reference to a RingBuffer to create a copy from.
+    /// @param alloc Allocator for the new buffer.
+    /// @pre T must meet CopyInsertable.
+    /// @post this == ring_buffer(rhs) but with a different allocator.
+    /// @throw Can throw std::bad_alloc, or something from T's CopyConstructor if not NoThrowCopyConstructible.
+    /// @except If any exception is thrown, invariants are preserved.(Basic Exception Guarantee).
+    /// @details Linear complexity in relation to buffer size.
+    ring_buffer(const ring_buffer& rhs, const allocator_type& alloc) : base(alloc, rhs.m_capacity), m_size(rhs.size()), m_tailIndex(0)
+    {
+        const auto segs = rhs.segments();
+        _constructFrom(segs.first.data(), segs.first.size(), segs.second.data(), segs.second.size());
+    }
+
+    /// @brief Move constructor.
+    /// @param other Rvalue reference to other buffer.
+    /// @details Constant complexity.
+    ring_buffer(ring_buffer&& other) noexcept : base(std::move(other)), migration(std::move(other)), m_size(std::exchange(other.m_size, 0)), m_tailIndex(std::exchange(other.m_tailIndex,0))
+    {
+    }
+
+    /// @brief Move constructor with different allocator.
+    /// @param other Rvalue reference to other buffer.
+    /// @param alloc Allocator for the new ring buffer.
+    /// @details Linear complexity in relation to buffer size.
+    ring_buffer(ring_buffer&& other, const allocator_type& alloc) : base(alloc, other.m_capacity), m_size(other.m_size), m_tailIndex(0)
+    {
+        const auto segs = other.segments();
+        _constructFrom(std::make_move_iterator(segs.first.data()), segs.first.size(), std::make_move_iterator(segs.second.data()), segs.second.size());
+
+        other.clear();
+    }
+
+    /// Destructor.
+    ~ring_buffer()
+    {
+        destroy_elements();
+    }
+
+    /// @brief Inserts an element to the buffer.
+    /// @param pos Iterator where the the element should be inserted. 
+    /// @param value Value to insert.
+    /// @return iterator pointing to the inserted value.
+    /// @pre T must meet CopyInsertable. 
+    /// @throw Might throw std::bad_alloc, or something from T's copy constructor if not NoThrow.
+    /// @exception  If any exception is thrown, the function does nothing (Strong exception guarantee).
+    /// @details Linear complexity in relation to buffer size and inserted elements. O(n).
+    iterator insert(const_iterator pos, const value_type& value)
+    {
+        return insertBase(pos, 1, value);
+    }
+
+    /// @brief Inserts an element to the buffer.
+    /// @param pos Iterator where the the element should be inserted
+    /// @param value Value to insert.
+    /// @return Iterator that pos to the inserted element.
+    /// @pre T must meet MoveInsertable.
+    /// @throw Might throw std::bad_alloc, or something from T's move/copy constructor.
+    /// @exception If any exception is thrown, the function does nothing (Strong exception guarantee).
+    /// @details Linear complexity in relation to buffer size and inserted elements. O(n).
+    iterator insert(const_iterator pos, value_type&& value)
+    {
+        return insertBase(pos, 1, std::move(value));
+    }
+
+    /// @brief Inserts an element to the buffer.
+    /// @param pos Iterator where the the element should be inserted
+    /// @param count Amount of T elements to be inserted.
+    /// @param value Value to insert.
+    /// @pre T must meet the requirements of CopyInsertable.
+    /// @return Iterator that pos to the inserted element.
+    /// @throw Might throw std::bad_alloc, or something from T's copy constructor if not NoThrow.
+    /// @exception  If any exception is thrown, the function does nothing (Strong exception guarantee).
+    /// @details Linear complexity in relation to buffer size and inserted elements. O(n).
+    iterator insert(const_iterator pos, const size_type count, const value_type& value)
+    {
+        if(count == 0) return iterator(this, pos.getIndex());
+        return insertBase(pos, count, value);
+    }
+
+    /// @brief Inserts a range of elements into the buffer to a specific position.
+    /// @tparam InputIt Type of iterator for the range.
+    /// @param pos A valid dereferenceable iterator to the position where range will be inserted to.
+    /// @param sourceBegin Iterator to first element of the range.
+    /// @param sourceEnd Iterator past the last element of the range.
+    /// @return Returns an iterator to an element in the buffer which is copy of the first element in the range.
+    /// @pre T must meet requirements of CopyInsertable. Iterators must point to elements that are implicitly convertible to value_type and sourceEnd must be reachable from sourceBegin. Otherwise behavior is undefined.
+    /// @throw Can throw std::bad_alloc or something from value_types constructor and iterator operations. 
+    /// @exception If memory is reallocated or the range is inserted at either end, the function does nothing if an exception is thrown (Strong exception guarantee).
+    /// Otherwise invariants are preserved (Basic exception guarantee).
+    /// @details Linear complexity in relation to inserted elements and the distance from pos to the closer end of the buffer, or to buffer size if memory is reallocated.
+    template <typename InputIt>
+    iterator insert(const_iterator pos, InputIt sourceBegin, InputIt sourceEnd)
+    {
+        return insertRangeBase(pos, sourceBegin, sourceEnd, typename std::iterator_traits<InputIt>::iterator_category());
+    }
+
+    /// @brief Inserts initializer list into buffer to a specific position.
+    /// @param pos Iterator where the list will be inserted.
+    /// @param list Initiliazer list to insert.
+    /// @pre pos must be a valid dereferenceable iterator within the container. Otherwise behavior is undefined.
+    /// @return Returns Iterator to the first element inserted, or the element pointed by pos if the initializer list was empty.
+    /// @throw Can throw std::bad_alloc and something from value_types constructor.
+    /// @exception If any exceptiong is thrown, the function does nothing (Strong exception guarantee).
+    /// @details Linear complexity in relation to buffer size and inserted elements. O(n).
+    iterator insert(const_iterator pos, std::initializer_list<T> list)
+    {   
+        return insertRangeBase(pos, list.begin(), list.end(), std::random_access_iterator_tag());
+    }
+
+    /// @brief Construct an element in place from arguments.
+    /// @param pos Iterator before which the new element will be constructed.
+    /// @param args Argument pack containing arguments to construct value_type element.
+    /// @return Returns an iterator pointing to the element constructed from args.
+    /// @pre T must meet EmplaceConstructible, MoveAssignalbe and MoveInsertable.
+    /// @post All iterators, pointers and references are invalidated.
+    /// @throw Can throw std::bad_alloc if memory is allocated. Can also throw from T's constructor when constructing the element, or from T's move constructor and move assignment.
+    /// @exception If T's construction throws the function has no effect. If moving throws, invariants are preserved (Basic exception guarantee).
+    /// @details Amortized linear complexity in relation to the distance from pos to the closer end of the buffer. The elements on that side are shifted to make room.
+    template<class... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        // Iterators hold addresses, so the position is saved as an index before memory may get reallocated.
+        const auto index = pos.getIndex();
+
+        if (static_cast<size_type>(index) == size())
+        {
+            emplace_back(std::forward<Args>(args)...);
+            _finishMigration();
+            return iterator(this, index);
+        }
+        else if (index == 0)
+        {
+            emplace_front(std::forward<Args>(args)...);
+            return begin();
+        }
+
+        // The element is constructed before reserving and shifting, because the arguments may refer to elements of the buffer.
+        _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<Args>(args)...);
+        validateCapacity(1);
+        _insertInPlace(index, 1, std::make_move_iterator(std::addressof(tempObj._getValue())));
+
+        return iterator(this, index);
+    }
+
+    /// @brief Constructs an element in place to front from argumets. If the buffer is full, the OverflowPolicy decides whether it grows, the last element is overwritten or std::length_error is thrown.
+    /// @param args Argument pack containing arguments to construct value_type element.
+    /// @pre value_type is EmplaceConstructible from args.
+    /// @throw Can throw std::bad_alloc if memory is allocated, or std::length_error if the buffer is full and rejects elements. Can also throw from T's constructor when constructing the element.
+    /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
+    /// @details  Amortized constant complexity.
+    template<class... Args>
+    void emplace_front(Args&&... args)
+    {
+        if (full())
+        {
+            overflowFront(OverflowPolicy(), std::forward<Args>(args)...);
+            return;
+        }
+
+        // Decrement temporary index in case constructor throws to retain invariants (elements of the buffer are always initialized).
+        auto newIndex = m_tailIndex;
+        decrement(newIndex);
+        alloc_traits::construct(base::_allocator(), base::m_data + newIndex, std::forward<Args>(args)...);
+        m_tailIndex = newIndex;
+        ++m_size;
+        _migrate();
+    }
+
+    /// @brief Constructs an element in place to back from argumets. If the buffer is full, the OverflowPolicy decides whether it grows, the first element is overwritten or std::length_error is thrown.
+    /// @param args Argument pack containing arguments to construct value_type element.
+    /// @pre value_type is EmplaceConstructible from args.
+    /// @throw Can throw std::bad_alloc if memory is allocated, or std::length_error if the buffer is full and rejects elements. Can also throw from T's constructor when constructing the element.
+    /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
+    /// @details Amortized constant complexity.
+    template<class... Args>
+    void emplace_back(Args&&... args)
+    {
+        if (full())
+        {
+            overflowBack(OverflowPolicy(), std::forward<Args>(args)...);
+            return;
+        }
+
+        alloc_traits::construct(base::_allocator(), base::m_data + _headIndex(), std::forward<Args>(args)...);
+        ++m_size;
+        _migrate();
+    }
+
+    /// @brief Constructs an element in place to the back of the buffer if there is room for it without growing.
+    /// @param args Argument pack containing arguments to construct value_type element.
+    /// @return True if the element was added, false if the buffer is full.
+    /// @pre value_type is EmplaceConstructible from args.
+    /// @throw Can throw from T's constructor when constructing the element.
+    /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
+    /// @details Constant complexity. Never allocates, regardless of the OverflowPolicy.
+    template<class... Args>
+    bool try_emplace_back(Args&&... args)
+    {
+        if (full()) return false;
+
+        alloc_traits::construct(base::_allocator(), base::m_data + _headIndex(), std::forward<Args>(args)...);
+        ++m_size;
+        _migrate();
+        return true;
+    }
+
+    /// @brief Copies an element to the back of the buffer if there is room for it without growing.
+    /// @param val Element to insert.
+    /// @return True if the element was added, false if the buffer is full.
+    /// @details Constant complexity.
+    bool try_push_back(const value_type& val)
+    {
+        return try_emplace_back(val);
+    }
+
+    /// @brief Moves an element to the back of the buffer if there is room for it without growing.
+    /// @param val Rvalue reference to the element to insert. Left untouched if the buffer is full.
+    /// @return True if the element was added, false if the buffer is full.
+    /// @details Constant complexity.
+    bool try_push_back(value_type&& val)
+    {
+        return try_emplace_back(std::move(val));
+    }
+
+    /// @brief Erase an element at a given position.
+    /// @param pos Pointer to the element to be erased.
+    /// @pre value_type must be nothrow-MoveConstructible. pos must be a valid dereferenceable iterator within the container. Otherwise behavior is undefined.
+    /// @return Returns an iterator that was immediately following the ereased element. If the erased element was last in the buffer, returns a pointer to end().
+    /// @exception If value_type is nothrow_move_constructible and nothrow_move_assignable function is noexcept. Otherwise provides no exception guarantee at all.
+    /// @details Linear Complexity in relation to distance of the nearer end of the buffer from the target element. Erasing the first or last element is constant.
+    iterator erase(const_iterator pos)
+    {
+        return eraseBase(pos, pos + 1);
+    }
+
+    /// @brief Erase the specified elements from the container according to the range [first,last). Elements on the shorter side of the range are move assigned over it. If first == begin() or last == end(), elements in [first,last) are only destroyed.
+    /// @param first iterator to the first element to erase.
+    /// @param last iterator past the last element to erase.
+    /// @pre First and last must be valid iterators to *this.
+    /// @return Returns an iterator to the element that was immediately following the last erased elements. If last == end(), then new end() is returned.
+    /// @throw Possibly throws from value_types move/copy assignment operator if first != begin() and last != end().
+    /// @exception If value_type is nothrow_move_constructible and nothrow_move_assignable function is noexcept. Otherwisde provides no exception guarantee at all.
+    /// @details Linear Complexity in relation to size of the range, and then linear in the remaining elements on the shorter side of the erased range.
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return eraseBase(first, last);
+    }
+
+    /// @brief Destroys all elements in a buffer. Does not modify capacity.
+    /// @post All existing references, pointers and iterators are to be considered invalid.
+    /// @details Linear complexity in relation to size of the buffer.
+    void clear() noexcept
+    {
+        destroy_elements();
+
+        m_size = 0;
+        m_tailIndex = 0;
+    }
+
+    /// @brief Replaces the elements in the buffer with copy of [sourceBegin, sourceEnd)
+    /// @param sourceBegin Iterator to beginning of the range.
+    /// @param sourceEnd Past the end iterator of the range.
+    /// @pre value_type is CopyInsertable and elements of [sourceBegin, sourceEnd) are not in *this. InputIt must be dereferenceable to value_type, and incrementing sourceBegin (repeatedly) must reach sourceEnd. Otherwise behaviour is undefined.
+    /// @post All existing references, pointers and iterators are to be considered invalid.
+    /// @throw Can throw std::bad_alloc or something from value_types constructor if not nothrow. 
+    /// @exception If any exception is throw, no memory is leaked but buffer will be in valid but unexpected state (Basic Exception Guarantee). If more memory is allocated, in case of any exception the function does nothing (Strong Exception Guarantee) 
+    /// @details Linear Complexity. Calls destructor for each element in buffer and CopyConstructor for the assigned range.
+    template <typename InputIt>
+    void assign(InputIt sourceBegin, InputIt sourceEnd)
+    {
+        size_type amount = std::distance(sourceBegin, sourceEnd);
+        if (base::m_capacity < amount)
+        {
+            base temp{base::_allocator(), grownCapacity(amount)};
+            _constructSegments({span(temp.m_data, amount), span()}, sourceBegin);
+            destroy_elements();
+            base::swap(*this, temp);
+            m_size = amount;
+            m_tailIndex = 0;
+
+            return;
+        }
+
+        clear();
+        _constructSegments(_range(0, amount), sourceBegin);
+        m_size = amount;
+    }
+
+    /// @brief Replaces the elements in the buffer with copy of the initializer list.
+    /// @param list Source of elements to assign.
+    /// @pre value_type is CopyInsertable.
+    /// @post All existing references, pointers and iterators are to be considered invalid.
+    /// @throw Can throw std::bad_alloc or something from value_types constructor if not nothrow. 
+    /// @exception If any exception is throw, no memory is leaked but buffer will be in valid but unexpected state (Basic Exception Guarantee). If more memory is allocated, in case of any exception the function does nothing (Strong Exception Guarantee) 
+    /// @details Linear Complexity. Calls destructor for each element in buffer and CopyConstructor for each element in the list.
+    void assign(std::initializer_list<T> list)
+    {
+        assign(list.begin(), list.end());
+    }
+
+    /// @brief Replaces the elements in the buffer with given value.
+    /// @param amount Size of the buffer after the assignment.
+    /// @param value Value of all elements after the assignment.
+    /// @pre value_type is CopyInsertable.
+    /// @post All existing references, pointers and iterators are to be considered invalid.
+    /// @throw Can throw std::bad_alloc or from value_types constructor.
+    /// @exception If any exception is throw, no memory is leaked but buffer will be in valid but unexpected state (Basic Exception Guarantee). If more memory is allocated and exception is thrown, function has no effect (Strong exception guarantee)
+    /// @details Linear Complexity. Calls destructor for each element in buffer and amount times values constructor.
+    void assign(const size_type amount, const value_type& value)
+    {
+
+        if (base::m_capacity < amount)
+        {
+            base temp{base::_allocator(), grownCapacity(amount)};
+            _fillSegments({span(temp.m_data, amount), span()}, value);
+            destroy_elements();
+            base::swap(*this, temp);
+            m_size = amount;
+            m_tailIndex = 0;
+
+            return;
+        }
+        
+        clear();
+        _fillSegments(_range(0, amount), value);
+        m_size = amount;
+    }
+
+    /// @brief Copy assignment operator.
+    /// @param other Ringbuffer to be copy assigned.
+    /// @return Returns reference to the assignment target container.
+    /// @post *this == other. All iterators, pointers and references of the target container should be considered invalid. Does not guarantee that target containers capacity equals the original.
+    /// @throw Can throw std::bad_alloc or something from value_types constructor.
+    /// @exception If any exception is thrown, invariants are retained and no memory is leaked (Basic Exception Guarantee).
+    /// @details Linear complexity in relation to buffer size. 
+    ring_buffer& operator=(const ring_buffer& other)
+    {
+
+        if (this == &other) return *this;
+
+        _finishMigration();
+
+        if (alloc_traits::propagate_on_container_copy_assignment::value && (base::_allocator() != other._allocator()))
+        {
+            auto temp = ring_buffer(other);
+
+            base::swap(*this, temp);
+            std::swap(m_tailIndex, temp.m_tailIndex);
+            std::swap(m_size, temp.m_size);
+        }
+        else
+        {
+            if (other.size() > size())
+            {
+                validateCapacity(other.size() - size());
+            }
+
+            auto targetSize = size();
+            auto sourceSize = other.size();
+
+            if (targetSize <= sourceSize)
+            {
+                std::copy(other.begin(), other.begin() + targetSize, begin());
+                for (size_type i = size(); i < sourceSize; i++)
+                {
+                    push_back(other[i]);
+                }
+            }
+            else
+            {
+                std::copy(other.begin(), other.end(), begin());
+                for (size_type i = sourceSize; i < targetSize; i++)
+                {
+                    pop_back();
+                }
+            }
+        }
+
+        return *this;
+    }
+
+    /// @brief Move assignment operator.
+    /// @param other Rvalue ref to other buffer.
+    /// @pre value_type is MoveConstructible.
+    /// @post *this has values other had before the assignment.
+    /// @return Reference to the buffer to move from.
+    /// @exception If value_type is not MoveConstructible, and if value_type provides a throwing CopyConstructor this function has undefined behaviour.
+    /// @details Constant complexity.
+    ring_buffer& operator=(ring_buffer&& other) noexcept
+    {
+        if (!alloc_traits::propagate_on_container_move_assignment::value && base::_allocator() != other._allocator())
+        {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+        }
+        else
+        {
+            ring_buffer temp(std::move(other));
+            temp.swap(*this);
+        }
+
+        return *this;
+    }
+
+    /// @brief Initializer list assign operator. 
+    /// @param init Initializer list to assign to the buffer.
+    /// @return Returns a reference to the buffer.
+    /// @pre T is CopyInsertable.
+    /// @post All existing iterators are invalidated. 
+    /// @note Internally calls assign(), which destroys all elements before CopyInserting from initializer list.
+    /// @details Linear complexity in relation to amount of existing elements and size of initializer list.
+    ring_buffer& operator=(std::initializer_list<T> init)
+    {
+        assign(init);
+        return *this;
+    }
+
+    /// @brief Index operator.
+    /// @param logicalIndex Index of the element. If LogicalIndex >= size(), this function has undefined behaviour.
+    /// @details Constant complexity.
+    /// @note The operator acts as interface that hides the physical memory layout from the user. Logical index neeeds to be added to internal tail index to get actual element address. 
+    /// @return Returns a reference to the element.
+    reference operator[](const size_type logicalIndex) noexcept
+    {
+        return *_slot(CapacityPolicy::wrap(m_tailIndex + logicalIndex, base::m_capacity));
+    }
+
+    /// @brief Index operator.
+    /// @param logicalIndex Index of the element used to access n:th element of the buffer.
+    /// @details Constant complexity
+    /// @note The operator acts as interface that hides the physical memory layout from the user. Logical index neeeds to be added to internal tail index to get actual element address.
+    /// @return Returns a const reference the the element ad logicalIndex.
+    const_reference operator[](const size_type logicalIndex) const noexcept
+    {
+        return *_slot(CapacityPolicy::wrap(m_tailIndex + logicalIndex, base::m_capacity));
+    }
+
+    /// @brief Get a specific element of the buffer with bounds checking.
+    /// @param logicalIndex Index of the element.
+    /// @return Returns a reference the the element at index.
+    /// @throw Throws std::out_of_range if index is larger or equal to buffers size.
+    /// @exception If any exceptions is thrown this function has no effect (Strong exception guarantee).
+    /// @details Constant complexity.
+    reference at(size_type logicalIndex)
+    {
+        if(logicalIndex >= size())
+        {
+            throw std::out_of_range("Index is out of range");
+        }
+
+        auto index = m_tailIndex + logicalIndex;
+
+        if(base::m_capacity <= index)
+        {
+            index -= base::m_capacity;
+        }
+        return *_slot(index);
+    }
+
+    /// @brief Get a specific element of the buffer.
+    /// @param logicalIndex Index of the element.
+    /// @return Returns a const reference the the element at index.
+    /// @throw Throws std::out_of_range if index is larger or equal to buffers size.
+    /// @exception If any exceptions is thrown this function has no effect (Strong exception guarantee).
+    /// @details Constant complexity.
+    const_reference at(size_type logicalIndex) const
+    {
+        if(logicalIndex >= size())
+        {
+            throw std::out_of_range("Index is out of range.");
+        }
+
+        auto index(m_tailIndex + logicalIndex);
+        if(base::m_capacity <= index)
+        {
+            index -= base::m_capacity;
+        }
+        return *_slot(index);
+    }
+
+    /// @brief Member swap implementation. Swaps RingBuffers member to member.
+    /// @param other Reference to a ring_buffer to swap with.
+    /// @details Constant complexity.
+    /// @note Requires allocator_type to return true_type from propagate_on_container_swap, otherwise memory operations 
+    void swap(ring_buffer& other) noexcept
+    {
+        using std::swap;
+        if (alloc_traits::propagate_on_container_swap::value)
+        {
+            swap(base::_allocator(), other._allocator());
+        }
+
+        swap(base::m_data, other.m_data);
+        swap(base::m_capacity, other.m_capacity);
+        swap(m_size, other.m_size);
+        swap(m_tailIndex, other.m_tailIndex);
+        migration::_swapMigration(other);
+    }
+
+    /// @brief Friend swap.
+    /// @param a Swap candidate.
+    /// @param b Swap candidate.
+    /// @details Constant complexity.
+    friend void swap(ring_buffer& a, ring_buffer& b) noexcept
+    {
+        a.swap(b);
+    }
+
+    /// @brief Replaces the contents of the buffer with elements in a memory block, taking ownership of the block without moving the elements.
+    /// @param storage Block allocated with an allocator equal to get_allocator(), for example one returned by release() or filled by hand with allocate and construct.
+    /// @throw Throws std::invalid_argument if storage.size > storage.capacity or the capacity is not one the CapacityPolicy would allocate (see pow2_capacity_policy).
+    /// @exception If any exception is thrown, function has no effect and the block is not taken (Strong exception guarantee).
+    /// @post size() == storage.size and capacity() == storage.capacity. All iterators, pointers and references to the previous elements are invalidated.
+    /// @details Linear complexity in relation to the previous size for destroying the previous elements, constant otherwise.
+    void adopt(raw_storage storage)
+    {
+        if (storage.size > storage.capacity || (storage.capacity != 0 && CapacityPolicy::round(storage.capacity) != storage.capacity))
+        {
+            throw std::invalid_argument("ring_buffer can not adopt the storage");
+        }
+
+        destroy_elements();
+
+        // The previous memory is released by temp.
+        base temp(base::_allocator(), 0);
+        base::swap(*this, temp);
+
+        base::m_data = storage.capacity == 0 ? nullptr : storage.data;
+        base::m_capacity = storage.capacity;
+        m_size = storage.size;
+        m_tailIndex = 0;
+    }
+
+    /// @brief Replaces the contents of the buffer with elements in a memory block, taking ownership of the block without moving the elements.
+    /// @param data Pointer to the block. Must be allocated with an allocator equal to get_allocator().
+    /// @param size Amount of constructed elements at the beginning of the block.
+    /// @param capacity Amount of elements the block was allocated for.
+    /// @details Same as adopt({data, size, capacity}).
+    void adopt(pointer data, size_type size, size_type capacity)
+    {
+        adopt(raw_storage{data, size, capacity});
+    }
+
+    /// @brief Hands the memory block over to the caller without moving the elements to new memory. Elements are moved to the beginning of the block first if they do not start there.
+    /// @return The block with the elements at its beginning. The caller destroys the elements and deallocates the block with get_allocator(), or passes it to adopt().
+    /// @throw Can throw std::bad_alloc if the elements have to be moved and T's move operations may throw, as they are then relocated to new memory.
+    /// @post empty() == true and capacity() == 0.
+    /// @details Constant complexity if the first element is at the beginning of the memory, which is the case after adopt(), reserve() or reallocation. Otherwise linear complexity in relation to size.
+    raw_storage release()
+    {
+        _finishMigration();
+
+        if (m_tailIndex != 0)
+        {
+            _moveToFront(_linearize_tag());
+        }
+
+        const raw_storage storage{base::m_data, m_size, base::m_capacity};
+        base::m_data = nullptr;
+        base::m_capacity = 0;
+        m_size = 0;
+        m_tailIndex = 0;
+        return storage;
+    }
+
+	/// @brief Makes the elements contiguous in memory. Elements that wrap around the end of the allocated memory are rotated in place.
+    /// @return Returns a pointer to the first element. The elements are stored in [data(), data() + size()).
+    /// @pre T must meet MoveInsertable, or CopyInsertable.
+    /// @post &this[0] + i == &this[i] for every i < size().
+    /// @throw Can throw std::bad_alloc if T's move constructor or move assignment may throw, as the elements are then relocated to new memory instead.
+    /// @exception If T's Move (or copy in case T does not provide Move Semantics) constructor throws, behaviour is undefined. Otherwise if exceptions are thrown (std::bad_alloc) this function has no effect (Strong exception guarantee).
+    /// @note Pointers and references are invalidated if the elements wrapped around. Nothing is allocated unless T's move operations may throw.
+    /// @details Constant complexity if the elements are already contiguous, otherwise linear complexity in relation to buffer size.
+    pointer data()
+    {
+        _finishMigration();
+
+        if (empty())
+        {
+            m_tailIndex = 0;
+            return base::m_data;
+        }
+
+        if (m_tailIndex + m_size > base::m_capacity)
+        {
+            _linearize(_linearize_tag());
+        }
+
+        return base::m_data + m_tailIndex;
+    }
+
+    /// @brief Gets the elements of the buffer as contiguous memory segments without moving them.
+    /// @return Pair of segments in logical order. The second segment is empty unless the elements wrap around the end of the allocated memory.
+    /// @note Unlike data(), does not allocate memory or move elements. Pointers are invalidated by the same operations as references.
+    /// @details Constant complexity.
+    std::pair<span, span> segments() noexcept
+    {
+        _finishMigration();
+        return _range(0, m_size);
+    }
+
+    /// @brief Gets the elements of the buffer as contiguous read-only memory segments without moving them.
+    /// @return Pair of segments in logical order. The second segment is empty unless the elements wrap around the end of the allocated memory.
+    /// @details Constant complexity.
+    std::pair<const_span, const_span> segments() const noexcept
+    {
+        auto segs = const_cast<ring_buffer*>(this)->segments();
+        return {const_span(segs.first.data(), segs.first.size()), const_span(segs.second.data(), segs.second.size())};
+    }
+
+    /// @brief Gets the unused memory of the buffer as contiguous segments of uninitialized memory.
+    /// @return Pair of segments in the order push_back would use them. The second segment is empty unless the free memory wraps around the end of the allocated memory.
+    /// @details Constant complexity.
+    std::pair<span, span> free_segments() noexcept
+    {
+        return _range(m_size, base::m_capacity - m_size);
+    }
+
+    /// @brief Gets the size of the container.
+    /// @return Size of buffer.
+    /// @details Constant complexity.
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @brief Gets the theoretical maximum size of the container.
+    /// @return Maximum size of the buffer.
+    /// @details Constant complexity.
+    size_type max_size() const noexcept
+    {
+        constexpr auto maxSize = std::numeric_limits<std::size_t>::max();
+        return maxSize / sizeof(T);
+    }
+
+    /// @brief Capacity getter.
+    /// @return m_capacity Returns how many elements have been allocated for the buffers use. 
+    /// @details Constant complexity.
+    size_type capacity() const noexcept
+    {
+        return base::m_capacity;
+    }
+
+    /// @brief Allocator getter.
+    /// @return Return the allocator used by the container.
+    /// @details Constant complexity.
+    allocator_type get_allocator() const noexcept
+    {
+        return base::_allocator();
+    }
+
+    /// @brief Check if buffer is empty
+    /// @return True if buffer is empty
+    /// @details Constant complexity.
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /// @brief Check if adding an element requires growing the buffer. A full buffer is handled by the OverflowPolicy.
+    /// @return True if buffer is full.
+    /// @details Constant complexity.
+    bool full() const noexcept
+    {
+        return m_size == base::m_capacity;
+    }
+
+    /// @brief Allocates memory and copies the existing buffer to the new memory location. Can be used to increase or decrease capacity.
+    /// @throw Throws std::bad_alloc if there is not enough memory for allocation. Throws std::bad_array_new_lenght if std::numeric_limits<std::size_t>::max() / sizeof(T) < newsize.
+    /// @param newCapacity Amount of memory to allocate. If newCapacity is less than or equal to m_capacity, function does nothing.
+    /// @param enableShrink True to enable reserve to reduce the capacity, to a minimum of size().
+    /// @pre T must meet MoveInsertable.
+    /// @throw Can throw std::bad_alloc. 
+    /// @exception If T's move constructor throws and T is not CopyInsertable, the elements are left in a valid but unspecified state. Otherwise Stong Exception Guarantee.
+    /// @note Elements are relocated with memcpy if T is trivially relocatable, moved if T is nothrow move constructible and otherwise copied.
+    /// @note All references, pointers and iterators are invalidated. If memory is allocated, the memory layout is rotated so that first element matches the beginning of physical memory.
+    /// If the buffer grows in place through the allocator's reallocate, only the shorter wrapped segment is moved and the layout is not rotated.
+    /// @details Linear complexity in relation to size of the buffer (O(n)).
+    void reserve(size_type newCapacity, bool enableShrink = false)
+    {
+        _finishMigration();
+
+        if (enableShrink)
+        {
+            if (newCapacity < size()) return;
+        }
+        else
+        {
+            if (newCapacity <= base::m_capacity) return;
+            if (tryReallocate(newCapacity)) return;
+        }
+
+        base temp = {base::_allocator(), newCapacity};
+        _relocate(temp.m_data);
+
+        m_tailIndex = 0;
+
+        base::swap(*this, temp);
+    }
+
+    /// @brief Finishes an incremental growth by moving the remaining elements to the grown memory and releasing the previous memory.
+    /// @note Only incremental_overflow_policy leaves growing unfinished. Operations other than push, pop, indexing, front() and back() call this first.
+    /// @post All pointers and references are invalidated if elements were moved.
+    /// @details Linear complexity in relation to the elements left in the previous memory, constant if no growth is in progress.
+    void finish_growth() noexcept
+    {
+        _finishMigration();
+    }
+
+    /// @brief Inserts an element in the back of the buffer. 
+    /// @note If buffer would get full after the operation, function allocates more memory.
+    /// @throw Can throw std::bad_alloc.
+    /// @param val Element to insert.
+    /// @pre T must satisfy CopyInsertable.
+    /// @post All iterators are invalidated. If more memory is allocated, all pointers and references are invalidated.
+    /// @exception If the copy constructor of value_type throws, behaviour is undefined. Otherwise in case of any exception this function has no effect (Strong Exception Guarantee).
+    /// @details Amortized constant complexity.
+    void push_front(const value_type& val)
+    {
+        emplace_front(val);
+    }
+
+    /// @brief Inserts an element in the back of the buffer by move if move constructor is provided by value_type.
+    /// @note If buffer would get full after the operation, allocates more memory.
+    /// @throw Can throw std::bad_alloc.
+    /// @param val Rvalue reference to the element to insert.
+    /// @pre value_type needs to satisfy MoveInsertable.
+    /// @post All iterators are invalidated. If more memory is allocated, all pointers and references are invalidated.
+    /// @exception If the move constructor of value_type throws, behaviour is undefined. Otherwise in case of any exception this function has no effect (Strong Exception Guarantee).
+    /// @details Amortized constant complexity.
+    void push_front(value_type&& val)
+    {
+        emplace_front(std::move(val));
+    }
+
+    /// @brief Inserts an element in the back of the buffer.
+    /// @param val Value of T to be appended.
+    /// @note If buffer would get full after the operation, allocates more memory.
+    /// @throw Can throw std::bad_alloc.
+    /// @exception If the copy constructor of value_type throws, behaviour is undefined. Otherwise in case of exception this function has no effect (Strong Exception Guarantee).
+    /// @pre value_type must satisfy CopyInsertable.
+    /// @post If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @details Amoprtized constant complexity.
+    void push_back(const value_type& val)
+    {
+        emplace_back(val);
+    }
+
+    /// @brief Inserts an element in the back of the buffer by move if move constructor is provided for value_type.
+    /// @note  If buffer would get full after the operation more memory is allocated.
+    /// @param val Rvalue reference to the value to be appended.
+    /// @throw Can throw std::bad_alloc.
+    /// @exception If the move/copy constructor of value_type throws, behaviour is undefined. Otherwise in case of any exception this function has no effect (Strong Exception Guarantee).
+    /// @pre value_type needs to satisfy MoveInsertable.
+    /// @post If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @details Amortized constant complexity.
+    void push_back(value_type&& val)
+    {
+        emplace_back(std::move(val));
+    }
+
+    /// @brief Inserts a range of elements to the back of the buffer.
+    /// @param sourceBegin Iterator to the first element of the range.
+    /// @param sourceEnd Iterator past the last element of the range.
+    /// @pre value_type must satisfy CopyInsertable. Elements of the range must not be in *this.
+    /// @post If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @throw Can throw std::bad_alloc or something from value_type's constructor.
+    /// @exception If any exception is thrown the elements of the buffer are not modified, but capacity may have grown (Strong exception guarantee for the elements). For input iterators Basic exception guarantee.
+    /// @details Linear complexity in relation to the size of the range. Capacity is checked once and the elements are constructed into at most two contiguous segments.
+    template<typename InputIt>
+    void append(InputIt sourceBegin, InputIt sourceEnd)
+    {
+        appendBase(sourceBegin, sourceEnd, typename std::iterator_traits<InputIt>::iterator_category());
+    }
+
+    /// @brief Inserts the elements of an initializer list to the back of the buffer.
+    /// @param list Elements to insert.
+    /// @details Linear complexity in relation to the size of the list.
+    void append(std::initializer_list<T> list)
+    {
+        append(list.begin(), list.end());
+    }
+
+    /// @brief Inserts a range of elements to the front of the buffer, keeping the order of the range. Same as insert(begin(), sourceBegin, sourceEnd) but without moving existing elements.
+    /// @param sourceBegin Iterator to the first element of the range.
+    /// @param sourceEnd Iterator past the last element of the range.
+    /// @pre value_type must satisfy CopyInsertable. ForwardIt must satisfy ForwardIterator. Elements of the range must not be in *this.
+    /// @post If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @throw Can throw std::bad_alloc or something from value_type's constructor.
+    /// @exception If any exception is thrown the elements of the buffer are not modified, but capacity may have grown (Strong exception guarantee for the elements).
+    /// @details Linear complexity in relation to the size of the range.
+    template<typename ForwardIt>
+    void prepend(ForwardIt sourceBegin, ForwardIt sourceEnd)
+    {
+        const size_type count = std::distance(sourceBegin, sourceEnd);
+        if (count == 0) return;
+
+        validateCapacity(count);
+
+        // Free slots before the tail, in logical order.
+        const auto segs = _range(base::m_capacity - count, count);
+        _constructSegments(segs, sourceBegin);
+
+        m_tailIndex = CapacityPolicy::wrap(m_tailIndex + base::m_capacity - count, base::m_capacity);
+        m_size += count;
+    }
+
+    /// @brief Inserts the elements of an initializer list to the front of the buffer, keeping the order of the list.
+    /// @param list Elements to insert.
+    /// @details Linear complexity in relation to the size of the list.
+    void prepend(std::initializer_list<T> list)
+    {
+        prepend(list.begin(), list.end());
+    }
+
+    /// @brief Remove the first element in the buffer.
+    /// @pre Buffers size > 0, otherwise behaviour is undefined.
+    /// @post All iterators, pointers and references are invalidated.
+    /// @details Constant complexity.
+    void pop_front() noexcept
+    {
+        alloc_traits::destroy(base::_allocator(), _slot(m_tailIndex));
+        _releasePending(m_tailIndex);
+        increment(m_tailIndex);
+        --m_size;
+        _migrate();
+    }
+
+    /// @brief Erase an element from the logical back of the buffer.
+    /// @pre Buffers size > 0, otherwise behaviour is undefined.
+    /// @post All pointers and references are invalidated. Iterators persist except end() - 1 iterator is invalidated (it becomes new past-the-last iterator).
+    /// @details Constant complexity.
+    void pop_back() noexcept
+    {
+        --m_size;
+        const auto index = _headIndex();
+        alloc_traits::destroy(base::_allocator(), _slot(index));
+        _releasePending(index);
+        _migrate();
+    }
+
+    /// @brief Removes count elements from the front of the buffer.
+    /// @param count Amount of elements to remove.
+    /// @pre count <= size(), otherwise behaviour is undefined.
+    /// @post Pointers and references to the removed elements are invalidated.
+    /// @details Constant complexity for trivially destructible types, otherwise linear in count.
+    void pop_front_n(size_type count) noexcept
+    {
+        if (count == 0) return;
+
+        _finishMigration();
+        _destroySegments(_range(0, count));
+        increment(m_tailIndex, count);
+        m_size -= count;
+    }
+
+    /// @brief Removes count elements from the back of the buffer.
+    /// @param count Amount of elements to remove.
+    /// @pre count <= size(), otherwise behaviour is undefined.
+    /// @post Pointers and references to the removed elements are invalidated.
+    /// @details Constant complexity for trivially destructible types, otherwise linear in count.
+    void pop_back_n(size_type count) noexcept
+    {
+        if (count == 0) return;
+
+        _finishMigration();
+        _destroySegments(_range(size() - count, count));
+        m_size -= count;
+    }
+
+    /// @brief Releases unused allocated memory. 
+    /// @pre T must satisfy MoveConstructible or CopyConstructible.
+    /// @post capacity() == size().
+    /// @note Reduces capacity by allocating a smaller memory area and moving the elements. An empty buffer releases all of its memory. Shrinking the buffer invalidates all pointers, iterators and references.
+    /// @throw Might throw std::bad_alloc if memory allocation fails.
+    /// @exception If T's move (or copy) constructor can and does throw, behaviour is undefined. If any other exception is thrown (bad_alloc) this function has no effect (Strong exception guarantee).
+    /// @details Linear complexity in relation to size of the buffer.
+    void shrink_to_fit()
+    {
+        _finishMigration();
+
+        if (empty())
+        {
+            base temp(base::_allocator(), 0);
+            base::swap(*this, temp);
+            m_tailIndex = 0;
+            return;
+        }
+
+        if (base::m_capacity == size()) return;
+
+        reserve(size(), true);
+    }
+
+    /// @brief Changes the amount of elements in the buffer. Elements are removed from or default inserted to the back.
+    /// @param count Size of the buffer after the operation.
+    /// @pre value_type must satisfy DefaultInsertable.
+    /// @post size() == count. If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @throw Can throw std::bad_alloc or something from value_type's constructor.
+    /// @exception If any exception is thrown the elements of the buffer are not modified (Strong exception guarantee for the elements).
+    /// @details Linear complexity in relation to the difference of size() and count.
+    void resize(size_type count)
+    {
+        resizeBase(count);
+    }
+
+    /// @brief Changes the amount of elements in the buffer. Elements are removed from or copies of value are inserted to the back.
+    /// @param count Size of the buffer after the operation.
+    /// @param value Value of the inserted elements.
+    /// @pre value_type must satisfy CopyInsertable.
+    /// @post size() == count. If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @throw Can throw std::bad_alloc or something from value_type's constructor.
+    /// @exception If any exception is thrown the elements of the buffer are not modified (Strong exception guarantee for the elements).
+    /// @details Linear complexity in relation to the difference of size() and count.
+    void resize(size_type count, const value_type& value)
+    {
+        resizeBase(count, value);
+    }
+
+    /// @brief Changes the amount of elements in the buffer. Elements are removed from or default-initialized to the back.
+    /// @param count Size of the buffer after the operation.
+    /// @pre value_type must satisfy DefaultInsertable.
+    /// @post size() == count. Trivially default constructible elements inserted with std::allocator have indeterminate values. If more memory is allocated all pointers, iterators and references are invalidated.
+    /// @throw Can throw std::bad_alloc or something from value_type's constructor.
+    /// @exception If any exception is thrown the elements of the buffer are not modified (Strong exception guarantee for the elements).
+    /// @details Linear complexity in relation to the difference of size() and count, constant if elements are left uninitialized and no memory is allocated.
+    void resize(size_type count, default_init_t)
+    {
+        resizeBase(count, default_init);
+    }
+
+//===========================================================
+//  std::queue adaptor functions
+//===========================================================
+
+    /// @brief Returns a reference to the first element in the buffer. Behaviour is undefined for empty buffer.
+    /// @return Reference to the first element.
+    /// @details Constant complexity.
+    reference front() noexcept
+    {
+        return *_slot(m_tailIndex);
+    }
+
+    /// @brief Returns a reference to the first element in the buffer. Behaviour is undefined for empty buffer.
+    /// @return const_reference to the first element.
+    /// @details Constant complexity.
+    const_reference front() const noexcept
+    {
+        return *_slot(m_tailIndex);
+    }
+
+    /// @brief Returns a reference to the last element in the buffer. Behaviour is undefined for empty buffer.
+    /// @return Reference to the last element in the buffer.
+    /// @details Constant complexity.
+    reference back() noexcept
+    {
+        return *_slot(CapacityPolicy::wrap(m_tailIndex + m_size - 1, base::m_capacity));
+    }
+
+    /// @brief Returns a const-reference to the last element in the buffer. Behaviour is undefined for empty buffer.
+    /// @return const_reference to the last element in the buffer.
+    /// @details Constant complexity.
+    const_reference back() const noexcept
+    {
+        return *_slot(CapacityPolicy::wrap(m_tailIndex + m_size - 1, base::m_capacity));
+    }
+
+    /// @brief Construct iterator at begin.
+    /// @return Iterator pointing to first element.
+    /// @details Constant complexity. Iterator is invalid if the buffer is empty (dereferencing points to uninitialized memory.).
+    iterator begin() noexcept
+    {
+        _finishMigration();
+        return iterator(this, 0);
+    }
+
+    /// @brief Construct const_iterator at begin.
+    /// @return Const_iterator pointing to first element.
+    /// @details Constant complexity. Iterator is invalid if the buffer is empty (dereferencing points to uninitialized memory.).
+    const_iterator begin() const noexcept
+    {
+        _finishMigration();
+        return const_iterator(this, 0);
+    }
+
+    /// @brief Construct iterator at end.
+    /// @return Iterator pointing past last element.
+    /// @details Constant complexity.
+    iterator end() noexcept
+    {
+        _finishMigration();
+        return iterator(this, size());
+    }
+
+    /// @brief Construct const_iterator at end.
+    /// @return Const_iterator pointing past last element.
+    /// @details Constant complexity.
+    const_iterator end() const noexcept
+    {
+        _finishMigration();
+        return const_iterator(this, size());
+    }
+
+    /// @brief Construct const_iterator at begin.
+    /// @return Const_iterator pointing to first element.
+    /// @details Constant complexity.
+    const_iterator cbegin() const noexcept
+    {
+        _finishMigration();
+        return const_iterator(this, 0);
+    }
+
+    /// @brief Construct const_iterator pointing to past the last element.
+    /// @return Const_iterator pointing past last element.
+    /// @details Constant complexity.
+    const_iterator cend() const noexcept
+    {
+        _finishMigration();
+        return const_iterator(this, size());
+    }
+
+    /// @brief Get a reverse iterator pointing to the first element in reverse order (last element in normal order).
+    /// @return reverse_iterator pointing to first element in reverse order.
+    /// @details Constant complexity. Iterator is invalid if the buffer is empty (dereferencing points to uninitialized memory.).
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    /// @brief Get a const reverse iterator pointing to the first element in reverse order (last element in normal order).
+    /// @return const_reverse_iterator pointing to the first element in reverse order.
+    /// @details Constant complexity.
+    const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /// @brief Get a const reverse iterator pointing to the first element in reverse order (last element in normal order).
+    /// @details Constant complexity.
+    /// @return const_reverse_iterator pointing to the first element in reverse order.
+    const_reverse_iterator crbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /// @brief Get a reverse iterator pointing to one past the last element in reverse order (one before the first element in normal order).
+    /// @details Constant complexity.
+    /// @return reverse_iterator pointing to one past the last element in reverse order.
+    reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    /// @brief Get a const reverse iterator pointing to one past the last element in reverse order (one before the first element in normal order).
+    /// @details Constant complexity.
+    /// @return const_reverse_iterator pointing to one past the last element in reverse order.
+    const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /// @brief Get a const reverse iterator pointing to one past the last element in reverse order (one before the first element in normal order).
+    /// @details Constant complexity.
+    /// @return const_reverse_iterator pointing to one past the last element in reverse order.
+    const_reverse_iterator crend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+
+private:
+
+    /// @brief Gets the address of an element for an iterator.
+    /// @param logicalIndex Logical index of the element.
+    /// @return Pointer to the element, or null pointer if logicalIndex is past the last element.
+    /// @details Constant complexity.
+    pointer _pointerAt(difference_type logicalIndex) const noexcept
+    {
+        if (static_cast<size_type>(logicalIndex) >= size())
+        {
+            return nullptr;
+        }
+        return base::m_data + CapacityPolicy::wrap(m_tailIndex + logicalIndex, base::m_capacity);
+    }
+
+    /// @brief Gets the logical index of an element pointed by an iterator.
+    /// @param ptr Pointer to an element, or null pointer for the past-the-last element.
+    /// @details Constant complexity.
+    difference_type _indexOf(const_pointer ptr) const noexcept
+    {
+        if (!ptr)
+        {
+            return size();
+        }
+        return CapacityPolicy::distance(m_tailIndex, ptr - base::m_data, base::m_capacity);
+    }
+
+    /// @brief Gets the address of the element following ptr.
+    /// @param ptr Pointer to an element.
+    /// @return Pointer to the next element, or null pointer if ptr pointed to the last element.
+    /// @details Constant complexity.
+    pointer _next(pointer ptr) const noexcept
+    {
+        if (++ptr == base::m_data + base::m_capacity)
+        {
+            ptr = base::m_data;
+        }
+        return ptr == base::m_data + _headIndex() ? nullptr : ptr;
+    }
+
+    /// @brief Splits the range between two element addresses into contiguous memory segments.
+    /// @param first Pointer to the first element, or null pointer for the past-the-last element.
+    /// @param last Pointer past the last element of the range, or null pointer for the past-the-last element.
+    /// @details Constant complexity.
+    std::pair<span, span> _segments(pointer first, pointer last) const noexcept
+    {
+        if (!first || first == last)
+        {
+            return {};
+        }
+
+        // Indices are used instead of addresses, since the first and the past-the-last slot are the same for a full buffer.
+        const auto index = _indexOf(first);
+        return _range(index, _indexOf(last) - index);
+    }
+
+    /// @brief Gets the address of the element preceding ptr.
+    /// @param ptr Pointer to an element, or null pointer for the past-the-last element.
+    /// @details Constant complexity.
+    pointer _prev(pointer ptr) const noexcept
+    {
+        if (!ptr)
+        {
+            ptr = base::m_data + _headIndex();
+        }
+        if (ptr == base::m_data)
+        {
+            ptr += base::m_capacity;
+        }
+        return ptr - 1;
+    }
+     
+    explicit ring_buffer(base&& rBufBase) : base(std::forward<base>(rBufBase)), m_size(0), m_tailIndex(0)
+    {
+    }
+
+    void destroy_elements() noexcept
+    {
+        _finishMigration();
+        _destroySegments(_range(0, size()));
+    }
+
+    using _relocation_tag = std::conditional_t<is_trivially_relocatable<T>::value && _has_default_construct<Allocator>::value, _relocate_memcpy_tag,
+        std::conditional_t<std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value, _relocate_move_tag, _relocate_copy_tag>>;
+
+    /// @brief Splits a logical range of elements into contiguous memory segments.
+    /// @param first Logical index of the first element.
+    /// @param count Amount of elements in the range.
+    /// @details Constant complexity.
+    std::pair<span, span> _range(size_type first, size_type count) const noexcept
+    {
+        if (count == 0)
+        {
+            return {};
+        }
+
+        const auto start = CapacityPolicy::wrap(m_tailIndex + first, base::m_capacity);
+        const auto firstCount = std::min(count, base::m_capacity - start);
+
+        return {span(base::m_data + start, firstCount), span(base::m_data, count - firstCount)};
+    }
+
+    /// @brief Relocates all elements to uninitialized memory, optionally leaving a gap of uninitialized slots in the middle.
+    /// @param dest Pointer to memory that can hold size() + gapSize elements.
+    /// @param gapIndex Logical index of the first element placed after the gap.
+    /// @param gapSize Amount of slots left uninitialized before the element at gapIndex.
+    /// @post Elements are alive only in dest, the memory of the buffer holds no elements. Indices are not modified.
+    /// @throw Can throw from T's copy constructor, or from T's move constructor if T is not CopyInsertable.
+    /// @exception If any exception is thrown nothing is left constructed in dest and the elements remain in the buffer. Elements are unchanged unless a throwing move constructor was used.
+    /// @details Linear complexity in relation to buffer size. Trivially relocatable elements are copied with memcpy segment by segment.
+    void _relocate(pointer dest, size_type gapIndex = 0, size_type gapSize = 0)
+    {
+        const auto prefix = _range(0, gapIndex);
+        const auto suffix = _range(gapIndex, size() - gapIndex);
+
+        const span sources[] = {prefix.first, prefix.second, suffix.first, suffix.second};
+        const pointer targets[] = {dest, dest + prefix.first.size(), dest + gapIndex + gapSize, dest + gapIndex + gapSize + suffix.first.size()};
+
+        _relocate(sources, targets, _relocation_tag());
+    }
+
+    void _relocate(const span (&sources)[4], const pointer (&targets)[4], _relocate_memcpy_tag) noexcept
+    {
+        for (size_t i = 0; i < 4; i++)
+        {
+            if (!sources[i].empty())
+            {
+                std::memcpy(static_cast<void*>(targets[i]), static_cast<const void*>(sources[i].data()), sources[i].size() * sizeof(T));
+            }
+        }
+    }
+
+    template<typename Tag>
+    void _relocate(const span (&sources)[4], const pointer (&targets)[4], Tag tag)
+    {
+        // With a nothrow move each source is destroyed right after it is moved from, while it is still in cache.
+        constexpr bool destroyEach = std::is_same<Tag, _relocate_move_tag>::value && std::is_nothrow_move_constructible<T>::value;
+
+        size_t segment = 0;
+        size_t current = 0;
+
+        try
+        {
+            for (; segment < 4; segment++)
+            {
+                for (current = 0; current < sources[segment].size(); current++)
+                {
+                    alloc_traits::construct(base::_allocator(), targets[segment] + current, _relocationSource(sources[segment].data()[current], tag));
+                    if (destroyEach)
+                    {
+                        alloc_traits::destroy(base::_allocator(), sources[segment].data() + current);
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            for (size_t i = 0; i <= segment; i++)
+            {
+                const auto constructed = i == segment ? current : sources[i].size();
+                for (size_t j = 0; j < constructed; j++)
+                {
+                    alloc_traits::destroy(base::_allocator(), targets[i] + j);
+                }
+            }
+            throw;
+        }
+
+        if (!destroyEach)
+        {
+            destroy_elements();
+        }
+    }
+
+    static value_type&& _relocationSource(value_type& value, _relocate_move_tag) noexcept
+    {
+        return std::move(value);
+    }
+
+    static const value_type& _relocationSource(value_type& value, _relocate_copy_tag) noexcept
+    {
+        return value;
+    }
+
+    // Elements can be rotated in place if moving them can't fail halfway.
+    using _linearize_tag = std::integral_constant<bool, std::is_same<_relocation_tag, _relocate_memcpy_tag>::value
+        || (std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value)>;
+
+    /// @brief Moves the elements so that the first element is at the beginning of the memory.
+    /// @details Linear complexity in relation to size of the buffer.
+    void _moveToFront(std::true_type) noexcept
+    {
+        if (m_tailIndex + m_size > base::m_capacity)
+        {
+            _linearize(std::true_type());
+        }
+        _shiftBlock(base::m_data + m_tailIndex, m_size, base::m_data);
+        m_tailIndex = 0;
+    }
+
+    void _moveToFront(std::false_type)
+    {
+        _linearize(std::false_type());
+    }
+
+    /// @brief Makes wrapped elements contiguous by relocating them to new memory of the same capacity.
+    /// @details Linear complexity in relation to buffer size.
+    void _linearize(std::false_type)
+    {
+        base temp = {base::_allocator(), base::m_capacity};
+        _relocate(temp.m_data);
+        base::swap(*this, temp);
+
+        m_tailIndex = 0;
+    }
+
+    /// @brief Makes wrapped elements contiguous without allocating. If the free slots between the segments can hold one of them, both segments are moved once
+    /// so that the elements follow each other. Otherwise the shorter segment closes the gap and the contiguous elements are rotated.
+    /// @details Linear complexity in relation to size of the buffer.
+    void _linearize(std::true_type)
+    {
+        const auto data = base::m_data;
+        const auto tailCount = base::m_capacity - m_tailIndex;
+        const auto headCount = m_size - tailCount;
+        const auto gap = base::m_capacity - m_size;
+
+        if (gap >= tailCount)
+        {
+            // Make room for the tail segment at the beginning of memory.
+            _shiftBlock(data, headCount, data + tailCount);
+            _shiftBlock(data + m_tailIndex, tailCount, data);
+            m_tailIndex = 0;
+        }
+        else if (gap >= headCount)
+        {
+            // Make room for the wrapped segment at the end of memory.
+            _shiftBlock(data + m_tailIndex, tailCount, data + gap);
+            _shiftBlock(data, headCount, data + gap + tailCount);
+            m_tailIndex = gap;
+        }
+        else if (headCount <= tailCount)
+        {
+            _shiftBlock(data, headCount, data + gap);
+            _rotate(data + gap, headCount, tailCount);
+            m_tailIndex = gap;
+        }
+        else
+        {
+            _shiftBlock(data + m_tailIndex, tailCount, data + headCount);
+            _rotate(data, headCount, tailCount);
+            m_tailIndex = 0;
+        }
+    }
+
+    /// @brief Swaps the adjacent blocks [first, first + leftCount) and [first + leftCount, first + leftCount + rightCount) with the block swap algorithm of Gries and Mills.
+    /// @details Linear complexity in relation to the size of the blocks. Each swap works on contiguous ranges, which vectorizes for trivial types.
+    void _rotate(pointer first, size_type leftCount, size_type rightCount) noexcept
+    {
+        const auto middle = first + leftCount;
+        auto i = leftCount;
+        auto j = rightCount;
+
+        while (i != j)
+        {
+            if (i > j)
+            {
+                std::swap_ranges(middle - i, middle - i + j, middle);
+                i -= j;
+            }
+            else
+            {
+                std::swap_ranges(middle - i, middle, middle + j - i);
+                j -= i;
+            }
+        }
+        std::swap_ranges(middle - i, middle, middle);
+    }
+
+    /// @brief Moves a contiguous block of elements to dest. The ranges may overlap, and the slots of the destination outside the source must be uninitialized.
+    /// @post The slots of the source outside the destination are uninitialized.
+    /// @details Linear complexity in relation to count.
+    void _shiftBlock(pointer first, size_type count, pointer dest) noexcept
+    {
+        _shiftBlock(first, count, dest, _relocation_tag());
+    }
+
+    void _shiftBlock(pointer first, size_type count, pointer dest, _relocate_memcpy_tag) noexcept
+    {
+        std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), count * sizeof(T));
+    }
+
+    template<typename Tag>
+    void _shiftBlock(pointer first, size_type count, pointer dest, Tag) noexcept
+    {
+        const auto last = first + count;
+
+        if (first < dest)
+        {
+            for (size_type i = count; i-- > 0;)
+            {
+                _moveInto(first + i, dest + i, dest + i >= last);
+            }
+            _destroySegments({span(first, std::min(dest, last) - first), span()});
+        }
+        else if (dest < first)
+        {
+            for (size_type i = 0; i < count; ++i)
+            {
+                _moveInto(first + i, dest + i, dest + i < first);
+            }
+            const auto kept = std::max(dest + count, first);
+            _destroySegments({span(kept, last - kept), span()});
+        }
+    }
+
+    void _moveInto(pointer from, pointer to, bool uninitialized) noexcept
+    {
+        if (uninitialized)
+        {
+            alloc_traits::construct(base::_allocator(), to, std::move(*from));
+        }
+        else
+        {
+            *to = std::move(*from);
+        }
+    }
+
+    // Memory can be grown in place if the allocator has the reallocate extension and the elements can be moved with memcpy.
+    using _reallocate_tag = std::integral_constant<bool, _has_reallocate<Allocator>::value && std::is_same<_relocation_tag, _relocate_memcpy_tag>::value>;
+
+    /// @brief Tries to grow the memory block in place with the allocator's reallocate extension.
+    /// @param newCapacity Requested capacity, rounded by the CapacityPolicy.
+    /// @return True if the buffer was grown. False if the allocator has no reallocate, elements are not trivially relocatable or reallocation failed.
+    /// @details Constant complexity if the elements do not wrap around, otherwise linear in the shorter wrapped segment.
+    bool tryReallocate(size_type newCapacity) noexcept
+    {
+        return tryReallocate(CapacityPolicy::round(newCapacity), _reallocate_tag());
+    }
+
+    bool tryReallocate(size_type, std::false_type) noexcept
+    {
+        return false;
+    }
+
+    bool tryReallocate(size_type newCapacity, std::true_type) noexcept
+    {
+        const auto oldCapacity = base::m_capacity;
+        if (newCapacity <= oldCapacity)
+        {
+            return false;
+        }
+
+        const auto grown = base::_allocator().reallocate(base::m_data, oldCapacity, newCapacity);
+        if (!grown)
+        {
+            return false;
+        }
+
+        base::m_data = grown;
+        base::m_capacity = newCapacity;
+
+        if (m_tailIndex + m_size > oldCapacity)
+        {
+            // Elements wrap around the old end of memory. Move the shorter segment so that the elements are contiguous modulo the new capacity.
+            const auto added = newCapacity - oldCapacity;
+            const auto tailCount = oldCapacity - m_tailIndex;
+            const auto headCount = m_size - tailCount;
+
+            if (headCount <= added && headCount < tailCount)
+            {
+                // Append the wrapped prefix [0, headCount) after the old end.
+                std::memcpy(static_cast<void*>(base::m_data + oldCapacity), static_cast<const void*>(base::m_data), headCount * sizeof(T));
+            }
+            else
+            {
+                // Shift the tail segment [tail, oldCapacity) to the new end of memory.
+                std::memmove(static_cast<void*>(base::m_data + m_tailIndex + added), static_cast<const void*>(base::m_data + m_tailIndex), tailCount * sizeof(T));
+                m_tailIndex += added;
+            }
+        }
+
+        return true;
+    }
+
+    // Growing and rejecting policies call grow, which throws std::length_error for the rejecting policy before anything is modified.
+    template<class Policy, class... Args>
+    void overflowFront(Policy, Args&&... args)
+    {
+        growFront(_reallocate_tag(), std::forward<Args>(args)...);
+    }
+
+    /// @brief Replaces the last element with an element constructed in front of the first element. The slot of the last element becomes the new first slot.
+    /// The new element is constructed to a temporary before the last element is destroyed, so arguments may refer to the last element.
+    /// @exception If constructing the element throws, function has no effect. If the move constructor of value_type throws, the last element is lost (Basic exception guarantee).
+    /// @details Constant complexity. If the buffer has no capacity for elements, the element is discarded.
+    template<class... Args>
+    void overflowFront(overwrite_overflow_policy, Args&&... args)
+    {
+        if (base::m_capacity == 0) return;
+
+        _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<Args>(args)...);
+
+        auto newIndex = m_tailIndex;
+        decrement(newIndex);
+        alloc_traits::destroy(base::_allocator(), base::m_data + newIndex);
+
+        try
+        {
+            alloc_traits::construct(base::_allocator(), base::m_data + newIndex, std::move(tempObj._getValue()));
+        }
+        catch (...)
+        {
+            --m_size;
+            throw;
+        }
+
+        m_tailIndex = newIndex;
+    }
+
+    template<class Policy, class... Args>
+    void overflowBack(Policy, Args&&... args)
+    {
+        growBack(_reallocate_tag(), std::forward<Args>(args)...);
+    }
+
+    /// @brief Replaces the first element with an element constructed after the last element. The slot of the first element becomes the new last slot.
+    /// The new element is constructed to a temporary before the first element is destroyed, so arguments may refer to the first element.
+    /// @exception If constructing the element throws, function has no effect. If the move constructor of value_type throws, the first element is lost (Basic exception guarantee).
+    /// @details Constant complexity. If the buffer has no capacity for elements, the element is discarded.
+    template<class... Args>
+    void overflowBack(overwrite_overflow_policy, Args&&... args)
+    {
+        if (base::m_capacity == 0) return;
+
+        _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<Args>(args)...);
+
+        alloc_traits::destroy(base::_allocator(), base::m_data + m_tailIndex);
+
+        try
+        {
+            alloc_traits::construct(base::_allocator(), base::m_data + m_tailIndex, std::move(tempObj._getValue()));
+        }
+        catch (...)
+        {
+            increment(m_tailIndex);
+            --m_size;
+            throw;
+        }
+
+        increment(m_tailIndex);
+    }
+
+    /// @brief Grows the buffer without relocating the elements. The new element is constructed in front of the elements in the new memory, the elements are moved by the following operations.
+    /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
+    /// @details Constant complexity, unless the previous migration is still in progress.
+    template<size_t Steps, class... Args>
+    void overflowFront(incremental_overflow_policy<Steps>, Args&&... args)
+    {
+        base temp(base::_allocator(), grownCapacity(size() + 1));
+
+        // Construct the new element before finishing a previous migration, since the arguments may refer to the elements it moves.
+        alloc_traits::construct(base::_allocator(), temp.m_data + temp.m_capacity - 1, std::forward<Args>(args)...);
+
+        _beginMigration(temp);
+        m_tailIndex = base::m_capacity - 1;
+        ++m_size;
+        _migrate();
+    }
+
+    /// @brief Grows the buffer without relocating the elements. The new element is constructed after the elements in the new memory, the elements are moved by the following operations.
+    /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
+    /// @details Constant complexity, unless the previous migration is still in progress.
+    template<size_t Steps, class... Args>
+    void overflowBack(incremental_overflow_policy<Steps>, Args&&... args)
+    {
+        base temp(base::_allocator(), grownCapacity(size() + 1));
+
+        // Construct the new element before finishing a previous migration, since the arguments may refer to the elements it moves.
+        alloc_traits::construct(base::_allocator(), temp.m_data + size(), std::forward<Args>(args)...);
+
+        _beginMigration(temp);
+        ++m_size;
+        _migrate();
+    }
+
+    using migration = typename ring_buffer::_migration_storage;
+    using _incremental_tag = std::integral_constant<bool, _migration_steps<OverflowPolicy>::value != 0>;
+
+    static_assert(!_incremental_tag::value || std::is_nothrow_move_constructible<T>::value, "incremental_overflow_policy requires a nothrow move constructible value_type.");
+
+    /// @brief Takes grown memory into use and keeps the elements in the previous memory. Element i moves to slot i of the new memory, so the tail index becomes 0.
+    /// @param temp Grown memory. Receives nothing back, the previous memory is owned by the migration state.
+    /// @details Constant complexity, unless the previous migration is still in progress.
+    void _beginMigration(base& temp) noexcept
+    {
+        _finishMigration();
+
+        base::swap(*this, temp);
+        migration::m_oldData = std::exchange(temp.m_data, nullptr);
+        migration::m_oldCapacity = temp.m_capacity;
+        migration::m_oldTail = m_tailIndex;
+        migration::m_pendingBegin = 0;
+        migration::m_pendingEnd = m_size;
+        m_tailIndex = 0;
+    }
+
+    /// @brief Gets the address of the element in a physical slot. During a migration the element may still be in the previous memory.
+    /// @param index Physical index in the current memory.
+    /// @details Constant complexity.
+    pointer _slot(size_type index) const noexcept
+    {
+        return _slot(index, _incremental_tag());
+    }
+
+    pointer _slot(size_type index, std::false_type) const noexcept
+    {
+        return base::m_data + index;
+    }
+
+    pointer _slot(size_type index, std::true_type) const noexcept
+    {
+        if (index - migration::m_pendingBegin < migration::m_pendingEnd - migration::m_pendingBegin)
+        {
+            return migration::m_oldData + CapacityPolicy::wrap(migration::m_oldTail + index, migration::m_oldCapacity);
+        }
+        return base::m_data + index;
+    }
+
+    /// @brief Stops tracking a popped element that was destroyed in the previous memory. Popped elements are always at either end of the pending slots.
+    /// @param index Physical index of the popped element.
+    /// @details Constant complexity.
+    void _releasePending(size_type index) noexcept
+    {
+        _releasePending(index, _incremental_tag());
+    }
+
+    void _releasePending(size_type, std::false_type) noexcept {}
+
+    void _releasePending(size_type index, std::true_type) noexcept
+    {
+        if (migration::m_pendingBegin == migration::m_pendingEnd) return;
+
+        if (index == migration::m_pendingBegin)
+        {
+            ++migration::m_pendingBegin;
+        }
+        else if (index + 1 == migration::m_pendingEnd)
+        {
+            --migration::m_pendingEnd;
+        }
+    }
+
+    /// @brief Moves a bounded amount of elements from the previous memory, and releases it once it is empty.
+    /// @details Constant complexity.
+    void _migrate() noexcept
+    {
+        _migrate(_incremental_tag());
+    }
+
+    void _migrate(std::false_type) noexcept {}
+
+    void _migrate(std::true_type) noexcept
+    {
+        if (!migration::m_oldData) return;
+
+        for (size_t moved = 0; moved < _migration_steps<OverflowPolicy>::value && migration::m_pendingBegin != migration::m_pendingEnd; ++moved)
+        {
+            _migrateElement(base::_allocator());
+        }
+
+        if (migration::m_pendingBegin == migration::m_pendingEnd)
+        {
+            _releaseOldMemory(base::_allocator());
+        }
+    }
+
+    /// @brief Moves all remaining elements from the previous memory and releases it.
+    /// @note Const member functions that need the elements in the current memory call this as well, which is why the migration state is mutable.
+    /// @details Linear complexity in relation to the elements left in the previous memory.
+    void _finishMigration() const noexcept
+    {
+        _finishMigration(_incremental_tag());
+    }
+
+    void _finishMigration(std::false_type) const noexcept {}
+
+    void _finishMigration(std::true_type) const noexcept
+    {
+        if (!migration::m_oldData) return;
+
+        // Copies of an allocator are interchangeable, and a copy can be used through a const buffer.
+        Allocator alloc(base::_allocator());
+        while (migration::m_pendingBegin != migration::m_pendingEnd)
+        {
+            _migrateElement(alloc);
+        }
+        _releaseOldMemory(alloc);
+    }
+
+    void _migrateElement(Allocator& alloc) const noexcept
+    {
+        const auto index = migration::m_pendingBegin;
+        const auto source = _slot(index);
+        alloc_traits::construct(alloc, base::m_data + index, std::move(*source));
+        alloc_traits::destroy(alloc, source);
+        ++migration::m_pendingBegin;
+    }
+
+    void _releaseOldMemory(Allocator& alloc) const noexcept
+    {
+        alloc_traits::deallocate(alloc, migration::m_oldData, migration::m_oldCapacity);
+        migration::m_oldData = nullptr;
+    }
+
+    /// @brief Grows the buffer and constructs an element in front of the first element. The element is constructed in the new memory before the old elements are relocated.
+    /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
+    /// @details Linear complexity in relation to buffer size.
+    template<class... Args>
+    void growFront(std::false_type, Args&&... args)
+    {
+        const auto sz = size();
+        base temp(base::_allocator(), grownCapacity(sz + 1));
+
+        // Construct the new element first so that a throwing constructor leaves the buffer untouched.
+        alloc_traits::construct(base::_allocator(), temp.m_data + temp.m_capacity - 1, std::forward<Args>(args)...);
+
+        try
+        {
+            _relocate(temp.m_data);
+        }
+        catch (...)
+        {
+            alloc_traits::destroy(base::_allocator(), temp.m_data + temp.m_capacity - 1);
+            throw;
+        }
+
+        base::swap(*this, temp);
+        m_size = sz + 1;
+        m_tailIndex = base::m_capacity - 1;
+    }
+
+    // Reallocating may move the memory block, so the element is constructed before the arguments referring to elements of the buffer are invalidated.
+    template<class... Args>
+    void growFront(std::true_type, Args&&... args)
+    {
+        _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<Args>(args)...);
+
+        if (!tryReallocate(grownCapacity(size() + 1)))
+        {
+            growFront(std::false_type(), std::move(tempObj._getValue()));
+            return;
+        }
+
+        auto newIndex = m_tailIndex;
+        decrement(newIndex);
+        alloc_traits::construct(base::_allocator(), base::m_data + newIndex, std::move(tempObj._getValue()));
+        m_tailIndex = newIndex;
+        ++m_size;
+    }
+
+    /// @brief Grows the buffer and constructs an element after the last element. The element is constructed in the new memory before the old elements are relocated.
+    /// @exception If any exception is thrown, function has no effect. (Strong exception guarantee).
+    /// @details Linear complexity in relation to buffer size.
+    template<class... Args>
+    void growBack(std::false_type, Args&&... args)
+    {
+        const auto sz = size();
+        base temp(base::_allocator(), grownCapacity(sz + 1));
+
+        // Construct the new element first so that a throwing constructor leaves the buffer untouched. This also keeps arguments referring to elements of the buffer valid.
+        alloc_traits::construct(base::_allocator(), temp.m_data + sz, std::forward<Args>(args)...);
+
+        try
+        {
+            _relocate(temp.m_data);
+        }
+        catch (...)
+        {
+            alloc_traits::destroy(base::_allocator(), temp.m_data + sz);
+            throw;
+        }
+
+        base::swap(*this, temp);
+        m_tailIndex = 0;
+        m_size = sz + 1;
+    }
+
+    template<class... Args>
+    void growBack(std::true_type, Args&&... args)
+    {
+        _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<Args>(args)...);
+
+        if (!tryReallocate(grownCapacity(size() + 1)))
+        {
+            growBack(std::false_type(), std::move(tempObj._getValue()));
+            return;
+        }
+
+        alloc_traits::construct(base::_allocator(), base::m_data + _headIndex(), std::move(tempObj._getValue()));
+        ++m_size;
+    }
+
+    /// @brief Constructs elements from a range into memory segments.
+    /// @param segs Segments of uninitialized memory, filled in order.
+    /// @param first Iterator to the first element of the source range. The range must hold at least as many elements as the segments.
+    /// @exception If any exception is thrown, elements constructed by this function are destroyed.
+    /// @details Linear complexity in relation to the size of the segments.
+    template<typename ForwardIt>
+    ForwardIt _constructSegments(const std::pair<span, span>& segs, ForwardIt first)
+    {
+        first = _constructSegment(segs.first, first);
+
+        try
+        {
+            return _constructSegment(segs.second, first);
+        }
+        catch (...)
+        {
+            _destroySegments({segs.first, span()});
+            throw;
+        }
+    }
+
+    template<typename ForwardIt>
+    ForwardIt _constructSegment(const span& seg, ForwardIt first)
+    {
+        using category = typename std::iterator_traits<ForwardIt>::iterator_category;
+        return _constructSegment(seg, first, std::integral_constant<bool, _has_default_construct<Allocator>::value && std::is_base_of<std::random_access_iterator_tag, category>::value>());
+    }
+
+    // The allocator constructs with placement new, so the standard algorithm can be used. It copies trivial types with memmove.
+    template<typename RandomIt>
+    RandomIt _constructSegment(const span& seg, RandomIt first, std::true_type)
+    {
+        const auto last = first + seg.size();
+        std::uninitialized_copy(first, last, seg.data());
+        return last;
+    }
+
+    template<typename ForwardIt>
+    ForwardIt _constructSegment(const span& seg, ForwardIt first, std::false_type)
+    {
+        size_type current = 0;
+
+        try
+        {
+            for (; current < seg.size(); ++current, (void)++first)
+            {
+                alloc_traits::construct(base::_allocator(), seg.data() + current, *first);
+            }
+        }
+        catch (...)
+        {
+            _destroySegments({span(seg.data(), current), span()});
+            throw;
+        }
+        return first;
+    }
+
+    /// @brief Constructs elements from two source ranges to the beginning of the memory area, in order.
+    /// @param first Iterator to the first source range.
+    /// @param firstCount Amount of elements in the first source range.
+    /// @param second Iterator to the second source range.
+    /// @param secondCount Amount of elements in the second source range.
+    /// @exception If any exception is thrown, elements constructed by this function are destroyed.
+    /// @details Linear complexity in relation to the amount of elements. Trivially copyable elements are copied with memmove.
+    template<typename RandomIt>
+    void _constructFrom(RandomIt first, size_type firstCount, RandomIt second, size_type secondCount)
+    {
+        _constructSegment(span(base::m_data, firstCount), first);
+
+        try
+        {
+            _constructSegment(span(base::m_data + firstCount, secondCount), second);
+        }
+        catch (...)
+        {
+            _destroySegments({span(base::m_data, firstCount), span()});
+            throw;
+        }
+    }
+
+    // Standard algorithms can be used if the allocator constructs with placement new. Value-initialization is only replaced for trivial types.
+    template<typename... Args>
+    using _fill_tag = std::integral_constant<bool, _has_default_construct<Allocator>::value && (sizeof...(Args) != 0 || std::is_trivial<T>::value)>;
+
+    /// @brief Constructs elements from arguments into memory segments. No arguments value-initializes the elements and default_init default-initializes them.
+    /// @exception If any exception is thrown, elements constructed by this function are destroyed.
+    /// @details Linear complexity in relation to the size of the segments. Trivial types are filled with memset or a vectorized loop, and left untouched if default-initialized.
+    template<typename... Args>
+    void _fillSegments(const std::pair<span, span>& segs, const Args&... args)
+    {
+        _fillSegment(segs.first, _fill_tag<Args...>(), args...);
+
+        try
+        {
+            _fillSegment(segs.second, _fill_tag<Args...>(), args...);
+        }
+        catch (...)
+        {
+            _destroySegments({segs.first, span()});
+            throw;
+        }
+    }
+
+    template<typename... Args>
+    void _fillSegment(const span& seg, std::false_type, const Args&... args)
+    {
+        size_type current = 0;
+
+        try
+        {
+            for (; current < seg.size(); ++current)
+            {
+                alloc_traits::construct(base::_allocator(), seg.data() + current, args...);
+            }
+        }
+        catch (...)
+        {
+            _destroySegments({span(seg.data(), current), span()});
+            throw;
+        }
+    }
+
+    // The allocator decides what default-initialization means.
+    void _fillSegment(const span& seg, std::false_type, default_init_t)
+    {
+        _fillSegment(seg, std::false_type());
+    }
+
+    void _fillSegment(const span& seg, std::true_type)
+    {
+        std::fill_n(seg.data(), seg.size(), value_type());
+    }
+
+    void _fillSegment(const span& seg, std::true_type, const value_type& value)
+    {
+        std::uninitialized_fill_n(seg.data(), seg.size(), value);
+    }
+
+    void _fillSegment(const span& seg, std::true_type, default_init_t)
+    {
+        _defaultInit(seg, std::is_trivially_default_constructible<T>());
+    }
+
+    void _defaultInit(const span&, std::true_type) noexcept
+    {
+    }
+
+    void _defaultInit(const span& seg, std::false_type)
+    {
+        size_type current = 0;
+
+        try
+        {
+            for (; current < seg.size(); ++current)
+            {
+                ::new (static_cast<void*>(seg.data() + current)) value_type;
+            }
+        }
+        catch (...)
+        {
+            _destroySegments({span(seg.data(), current), span()});
+            throw;
+        }
+    }
+
+    /// @brief Gets the address of a slot by logical index. Unlike _pointerAt, also works for the free slots after the last element.
+    /// @param logicalIndex Logical index of the slot. Must be less than capacity.
+    /// @details Constant complexity.
+    pointer _address(size_type logicalIndex) const noexcept
+    {
+        return base::m_data + CapacityPolicy::wrap(m_tailIndex + logicalIndex, base::m_capacity);
+    }
+
+    /// @brief Move assigns count elements starting from logical index src to the elements starting from logical index dst. The ranges may overlap.
+    /// @details Linear complexity in relation to count. The elements are moved in at most three contiguous chunks with std::move or std::move_backward.
+    void _moveElements(size_type src, size_type count, size_type dst)
+    {
+        if (dst < src)
+        {
+            while (count > 0)
+            {
+                const auto from = _address(src);
+                const auto to = _address(dst);
+                const auto len = std::min(count, static_cast<size_type>(base::m_data + base::m_capacity - std::max(from, to)));
+
+                std::move(from, from + len, to);
+                src += len;
+                dst += len;
+                count -= len;
+            }
+        }
+        else if (src < dst)
+        {
+            while (count > 0)
+            {
+                const auto fromEnd = _address(src + count - 1) + 1;
+                const auto toEnd = _address(dst + count - 1) + 1;
+                const auto len = std::min(count, static_cast<size_type>(std::min(fromEnd, toEnd) - base::m_data));
+
+                std::move_backward(fromEnd - len, fromEnd, toEnd);
+                count -= len;
+            }
+        }
+    }
+
+    /// @brief Destroys the elements in memory segments. Skipped for trivially destructible types if the allocator does not customize destruction.
+    /// @details Linear complexity in relation to the size of the segments, or constant if destruction is skipped.
+    void _destroySegments(const std::pair<span, span>& segs) noexcept
+    {
+        if (std::is_trivially_destructible<T>::value && _has_default_construct<Allocator>::value) return;
+
+        for (auto& elem : segs.first)
+        {
+            alloc_traits::destroy(base::_allocator(), &elem);
+        }
+        for (auto& elem : segs.second)
+        {
+            alloc_traits::destroy(base::_allocator(), &elem);
+        }
+    }
+
+    /// @brief Move constructs count elements starting from logical index src to uninitialized slots starting from logical index dst. The ranges must not overlap.
+    /// @exception If any exception is thrown, elements constructed by this function are destroyed.
+    /// @details Linear complexity in relation to count.
+    void _moveConstruct(size_type src, size_type count, size_type dst)
+    {
+        _constructSegments(_range(dst, count), std::make_move_iterator(begin() + src));
+    }
+
+    /// @brief Assigns elements from a range to the elements in memory segments.
+    /// @return Iterator past the last source element used.
+    /// @details Linear complexity in relation to the size of the segments.
+    template<typename ForwardIt>
+    ForwardIt _assignSegments(const std::pair<span, span>& segs, ForwardIt first)
+    {
+        for (auto& elem : segs.first)
+        {
+            elem = *first;
+            ++first;
+        }
+        for (auto& elem : segs.second)
+        {
+            elem = *first;
+            ++first;
+        }
+        return first;
+    }
+
+    /// @brief Inserts count elements from a range at a logical index without reallocating. The elements on the shorter side of the index are shifted to make room,
+    /// so insertion in the first half uses the free slots before the tail and insertion in the second half the free slots after the head.
+    /// @param index Logical index of the first inserted element.
+    /// @param count Amount of elements to insert.
+    /// @param first Iterator to the first element of the source range. The range must not refer to elements of the buffer.
+    /// @pre Capacity must hold size() + count elements.
+    /// @exception If constructing an element from the range throws before any element is moved the function has no effect. Otherwise invariants are preserved (Basic exception guarantee).
+    /// @details Linear complexity in relation to count plus the amount of elements on the shorter side.
+    template<typename ForwardIt>
+    void _insertInPlace(size_type index, size_type count, ForwardIt first)
+    {
+        const auto sz = size();
+
+        if (index < sz - index)
+        {
+            // Logical index of the new first element, counted from the current tail.
+            const auto front = base::m_capacity - count;
+
+            if (index >= count)
+            {
+                // The first count elements move to the free slots, the rest are shifted by assignment.
+                _moveConstruct(0, count, front);
+                decrement(m_tailIndex, count);
+                m_size += count;
+                _moveElements(2 * count, index - count, count);
+                _assignSegments(_range(index, count), first);
+            }
+            else
+            {
+                // Part of the new elements go to free slots, so they are constructed before anything is moved.
+                const auto created = _range(front + index, count - index);
+                const auto rest = _constructSegments(created, first);
+                try
+                {
+                    _moveConstruct(0, index, front);
+                }
+                catch (...)
+                {
+                    _destroySegments(created);
+                    throw;
+                }
+                decrement(m_tailIndex, count);
+                m_size += count;
+                _assignSegments(_range(count, index), rest);
+            }
+        }
+        else
+        {
+            const auto after = sz - index;
+
+            if (after >= count)
+            {
+                _moveConstruct(sz - count, count, sz);
+                m_size += count;
+                _moveElements(index, after - count, index + count);
+                _assignSegments(_range(index, count), first);
+            }
+            else
+            {
+                const auto created = _range(sz, count - after);
+                _constructSegments(created, std::next(first, after));
+                try
+                {
+                    _moveConstruct(index, after, index + count);
+                }
+                catch (...)
+                {
+                    _destroySegments(created);
+                    throw;
+                }
+                m_size += count;
+                _assignSegments(_range(index, after), first);
+            }
+        }
+    }
+
+    template<typename ForwardIt>
+    void appendBase(ForwardIt sourceBegin, ForwardIt sourceEnd, std::forward_iterator_tag)
+    {
+        const size_type count = std::distance(sourceBegin, sourceEnd);
+        if (count == 0) return;
+
+        validateCapacity(count);
+
+        // Free slots after the head.
+        _constructSegments(_range(size(), count), sourceBegin);
+        m_size += count;
+    }
+
+    template<typename InputIt>
+    void appendBase(InputIt sourceBegin, InputIt sourceEnd, std::input_iterator_tag)
+    {
+        for (; sourceBegin != sourceEnd; ++sourceBegin)
+        {
+            emplace_back(*sourceBegin);
+        }
+    }
+
+    template<typename... Args>
+    void resizeBase(size_type count, const Args&... args)
+    {
+        const auto sz = size();
+
+        if (count <= sz)
+        {
+            pop_back_n(sz - count);
+            return;
+        }
+
+        validateCapacity(count - sz);
+
+        _fillSegments(_range(sz, count - sz), args...);
+        m_size = count;
+    }
+
+    /// @brief Gets the physical index past the last element, where push_back constructs the next element. Equals m_tailIndex when the buffer is full.
+    /// @details Constant complexity.
+    size_type _headIndex() const noexcept
+    {
+        return CapacityPolicy::wrap(m_tailIndex + m_size, base::m_capacity);
+    }
+
+    /// @brief Gets the capacity to grow to, as decided by the GrowthPolicy.
+    /// @param required Minimum capacity needed.
+    /// @throw Throws std::length_error if the OverflowPolicy keeps the buffer bounded.
+    /// @details Constant complexity.
+    size_type grownCapacity(size_type required) const
+    {
+        return grownCapacity(required, OverflowPolicy());
+    }
+
+    size_type grownCapacity(size_type required, grow_overflow_policy) const noexcept
+    {
+        return GrowthPolicy::grow(base::m_capacity, required, sizeof(T));
+    }
+
+    template<size_t Steps>
+    size_type grownCapacity(size_type required, incremental_overflow_policy<Steps>) const noexcept
+    {
+        return GrowthPolicy::grow(base::m_capacity, required, sizeof(T));
+    }
+
+    template<class Policy>
+    size_type grownCapacity(size_type, Policy) const
+    {
+        throw std::length_error("ring_buffer is full");
+    }
+
+    /// @brief Reserves more memory if needed for an increase in size. The new capacity is decided by the GrowthPolicy.
+    /// @param increase Expected increase in size of the buffer, based on which memory is allocated.
+    /// @details Linear complexity in relation to buffer size if more memory needs to be allocated, otherwise constant complexity.
+    /// @exception May throw std::bad_alloc. If any exception is thrown this function does nothing. Strong exception guarantee.
+    /// @note This function should be called before increasing the size of the buffer.
+    void validateCapacity(size_t increase)
+    {
+        if (base::m_capacity >= size() + increase) return;
+
+        reserve(grownCapacity(size() + increase));
+    }
+
+    /// @brief Base function for inserting elements by value and amount.
+    /// @tparama U value type of the inserted element.
+    /// @param pos Iterator pointing to the element where after insert new element will exist.
+    /// @param count Amount of elements to insert. Must be 1 if value is an rvalue.
+    /// @param value Universal reference of value to insert.
+    /// @pre T Must satisfy CopyInsertable or MoveInsertable.
+    /// @return Returns iterator pointing to the first element inserted.
+    /// @throw Might throw std::bad_alloc from allocating memory, or something from T's move/copy constructor.
+    /// @exception If memory is reallocated or the elements are inserted at either end, the function has no effect if an exception is thrown (Strong exception guarantee).
+    /// Otherwise invariants are preserved (Basic exception guarantee).
+    /// @details Linear complexity in relation to inserted elements and the distance from pos to the closer end of the buffer, or to buffer size if memory is reallocated.
+    template<typename U>
+    iterator insertBase(const_iterator pos, const size_type count, U&& value)
+    {
+        const auto index = pos.getIndex();
+
+        if (count == 1 && pos == end())
+        {
+            emplace_back(std::forward<U>(value));
+            _finishMigration();
+            return iterator(this, index);
+        }
+        else if (count == 1 && pos == begin())
+        {
+            emplace_front(std::forward<U>(value));
+            _finishMigration();
+            return iterator(this, index);
+        }
+
+        if (base::m_capacity < size() + count)
+        {   
+            //Reallocate and relocate whole buffer around the inserted elements. Strong guarantee
+            const auto sz = size();
+            base temp(base::_allocator(), grownCapacity(sz + count));
+
+            // Insert the element(s) first, so that the buffer is untouched if a constructor throws.
+            size_type constructed = 0;
+            try
+            {
+                for (; constructed < count; constructed++)
+                {
+                    alloc_traits::construct(base::_allocator(), temp.m_data + index + constructed, std::forward<U>(value));
+                }
+
+                _relocate(temp.m_data, index, count);
+            }
+            catch (...)
+            {
+                for (size_type i = 0; i < constructed; i++)
+                {
+                    alloc_traits::destroy(base::_allocator(), temp.m_data + index + i);
+                }
+                throw;
+            }
+
+            base::swap(*this, temp);
+            m_size = sz + count;
+            m_tailIndex = 0;
+
+            return iterator(this, index);
+        }
+        else
+        {
+            // Copy of the value, as it may refer to an element that gets shifted.
+            _alloc_temp<Allocator> tempObj(base::_allocator(), std::forward<U>(value));
+            insertValue(index, count, tempObj._getValue(), std::is_lvalue_reference<U>());
+
+            return iterator(this, index);
+        }
+    }
+
+    // Rvalues are inserted only once, so the value is moved.
+    void insertValue(size_type index, size_type, value_type& value, std::false_type)
+    {
+        _insertInPlace(index, 1, std::make_move_iterator(std::addressof(value)));
+    }
+
+    void insertValue(size_type index, size_type count, value_type& value, std::true_type)
+    {
+        _insertInPlace(index, count, _repeat_iterator<T>{std::addressof(value), 0});
+    }
+
+    /// @brief Base function for inserting elements from a range of [rangeBegin, rangeEnd). If the capacity suffices, the elements on the shorter side of pos are shifted
+    /// to open a gap, and the range is constructed directly into it. Otherwise the buffer is relocated to new memory around the range.
+    /// @tparam ForwardIt type of the source ranges iterator.
+    /// @param pos Iterator pointing to the element where after insert new element will exist.
+    /// @param rangeBegin Iterator pointing to the first element of the range.
+    /// @param rangeEnd Iterator pointing past the last element to be inserted.
+    /// @return Returns iterator pointing to the first element inserted.
+    /// @pre value_type must meet CopyInsertable. ForwardIt must be deferencable to value_type, and incrementing rangeBegin possibly multiple times should reach rangeEnd. Otherwise behaviour is undefined.
+    /// @throw Might throw std::bad_alloc from allocating memory, or something from T's move/copy constructor.
+    /// @exception If memory is reallocated or the range is inserted at either end, the function has no effect if an exception is thrown (Strong exception guarantee).
+    /// Otherwise invariants are retained (Basic Exception guarantee).
+    /// @details Linear complexity in relation to inserted elements and the distance from pos to the closer end of the buffer, or to buffer size if memory is reallocated.
+    template<typename ForwardIt>
+    iterator insertRangeBase(const_iterator pos, ForwardIt rangeBegin, ForwardIt rangeEnd, std::forward_iterator_tag)
+    {
+        _finishMigration();
+
+        const size_type amount = std::distance(rangeBegin, rangeEnd);
+        const auto index = pos.getIndex();
+        const auto sz = size();
+
+        if (amount == 0)
+        {
+            return iterator(this, index);
+        }
+
+        // A range of the buffer's own elements would be overwritten while shifting or left dangling by realloc, so it is always copied to new memory.
+        const bool aliased = _refersToElements(rangeBegin);
+        const bool fits = base::m_capacity >= sz + amount;
+
+        if (!aliased && (fits || tryReallocate(grownCapacity(sz + amount))))
+        {
+            _insertInPlace(index, amount, rangeBegin);
+            return iterator(this, index);
+        }
+
+        base temp(base::_allocator(), fits ? base::m_capacity : grownCapacity(sz + amount));
+
+        // Construct the range first, so that the buffer is untouched if a constructor throws. Also keeps ranges from *this valid.
+        size_type constructed = 0;
+        try
+        {
+            for (; constructed < amount; ++rangeBegin, (void)++constructed)
+            {
+                alloc_traits::construct(base::_allocator(), temp.m_data + index + constructed, *rangeBegin);
+            }
+
+            _relocate(temp.m_data, index, amount);
+        }
+        catch (...)
+        {
+            for (size_type i = 0; i < constructed; i++)
+            {
+                alloc_traits::destroy(base::_allocator(), temp.m_data + index + i);
+            }
+            throw;
+        }
+
+        base::swap(*this, temp);
+        m_size = sz + amount;
+        m_tailIndex = 0;
+
+        return iterator(this, index);
+    }
+
+    // Single pass input iterators can't be counted in advance, so the range is first read into a temporary buffer.
+    template<typename InputIt>
+    iterator insertRangeBase(const_iterator pos, InputIt rangeBegin, InputIt rangeEnd, std::input_iterator_tag)
+    {
+        ring_buffer temp(base::_allocator());
+        temp.append(rangeBegin, rangeEnd);
+
+        return insertRangeBase(pos, std::make_move_iterator(temp.begin()), std::make_move_iterator(temp.end()), std::random_access_iterator_tag());
+    }
+
+    /// @brief Checks if an iterator refers to an element in the memory of the buffer.
+    /// @details Constant complexity. Iterators that do not dereference to an lvalue never refer to the buffer.
+    template<typename It>
+    bool _refersToElements(const It& it) const noexcept
+    {
+        return _refersToElements(it, std::is_lvalue_reference<typename std::iterator_traits<It>::reference>());
+    }
+
+    template<typename It>
+    bool _refersToElements(const It& it, std::true_type) const noexcept
+    {
+        const std::less<const void*> less;
+        const void* address = std::addressof(*it);
+        return !less(address, base::m_data) && less(address, base::m_data + base::m_capacity);
+    }
+
+    template<typename It>
+    bool _refersToElements(const It&, std::false_type) const noexcept
+    {
+        return false;
+    }
+
+    /// @brief Base function for erasing elements from the buffer. Elements on the shorter side of the range are shifted over the erased elements by move assignment,
+    /// and the vacated slots at that end of the buffer are destroyed.
+    /// @param first Iterator pointing to the first element of the range to erase.
+    /// @param last Iterator pointing to past the last element to erase.
+    /// @return Returns an iterator pointing to the element immediately after the erased elements.
+    /// @pre First and last must be valid iterators to *this.
+    /// @exception If value_types move assignment is NoThrow, function is noexcept. If it throws, the buffer is left in a valid but unspecified state.
+    /// @details Linear complexity in relation to the size of the range plus the amount of elements on the shorter side. Erasing at begin() or end() only destroys the range.
+    iterator eraseBase(const_iterator first, const_iterator last)
+    {
+        _finishMigration();
+
+        const auto index = static_cast<size_type>(first.getIndex());
+        const auto count = static_cast<size_type>(std::distance(first, last));
+
+        if (count > 0)
+        {
+            if (index < size() - index - count)
+            {
+                // Fewer elements before the range. Shift them toward the end and release the front.
+                _moveElements(0, index, count);
+                pop_front_n(count);
+            }
+            else
+            {
+                _moveElements(index + count, size() - index - count, index);
+                pop_back_n(count);
+            }
+        }
+
+        // Iterator is constructed after erasing, so that it becomes end() if the erased range reached the end.
+        return iterator(this, index);
+    }
+
+    /// @brief Increment an index. The ringbuffer internally increments the head and tail index when adding elements.
+    /// @param index The index to increment.
+    /// @details Constant complexity.
+    void increment(size_t& index) noexcept
+    {
+        // Wrap index around at end of physical memory area.
+        index = CapacityPolicy::next(index, base::m_capacity);
+    }
+
+    /// @brief Increments an index multiple times. The ringbuffer internally increments the head and tail index when adding elements.
+    /// @param index Index to increment.
+    /// @param times Amount of increments. Must not be larger than capacity.
+    /// @details Constant complexity.
+    void increment(size_t& index, size_t times) noexcept
+    {
+        index = CapacityPolicy::wrap(index + times, base::m_capacity);
+    }
+
+    /// @brief Decrements an index. The ringbuffer internally decrements the head and tail index when removing elements.
+    /// @param index The index to decrement.
+    /// @details Constant complexity.
+    void decrement(size_t& index) noexcept
+    {
+        index = CapacityPolicy::prev(index, base::m_capacity);
+    }
+    
+    /// @brief Decrements an index multiple times. The ringbuffer internally decrements the head and tail index when removing elements.
+    /// @param index Index to decrement.
+    /// @param times Amount of decrements. Must not be larger than capacity.
+    /// @details Constant complexity.
+    void decrement(size_t& index, size_t times) noexcept
+    {
+        index = CapacityPolicy::wrap(index + base::m_capacity - times, base::m_capacity);
+    }
+
+    size_type m_size; /*!< Amount of elements in the buffer.*/
+    size_type m_tailIndex; /*!< Index of the tail. Index to the first element in the buffer.*/
+
+};
+
+
+//===========================
+// Non-member functions
+//===========================
+
+/// @brief Equality comparator. Compares buffers element-to-element.
+/// @tparam T Value type
+/// @tparam Alloc Optional custom allocator. Defaults to std::allocator<T>.
+/// @param lhs Left hand side operand
+/// @param rhs right hand side operand
+/// @return returns true if the buffers elements compare equal.
+template<typename T, typename Alloc, typename Policy, typename Growth, typename Overflow>
+inline bool operator==(const ring_buffer<T,Alloc,Policy,Growth,Overflow>& lhs, const ring_buffer<T,Alloc,Policy,Growth,Overflow>& rhs)
+{
+    if(lhs.size() != rhs.size())
+    {
+        return false;
+    }
+
+    for(size_t i = 0; i < lhs.size(); i++)
+    {
+        if(lhs[i] != rhs[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief Not-equal comparator. Compares buffers element-to-element.
+/// @tparam T Value type
+/// @tparam Alloc Optional custom allocator. Defaults to std::allocator<T>.
+/// @param lhs Left hand side operand.
+/// @param rhs Right hand side operand.
+/// @return returns True if any of the elements are not equal.
+template<typename T, typename Alloc, typename Policy, typename Growth, typename Overflow>
+inline bool operator!=(const ring_buffer<T,Alloc,Policy,Growth,Overflow>& lhs, const ring_buffer<T,Alloc,Policy,Growth,Overflow>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+//===========================
+// Segment-aware algorithms
+//===========================
+
+/// @brief Algorithms that split ring_buffer iterator ranges into their contiguous memory segments and run the standard algorithm
+/// on raw pointers of each segment. For any other iterators the call is forwarded to the standard algorithm as is.
+namespace rbuf
+{
+    template<typename It, typename = void>
+    struct is_ring_buffer_iterator : std::false_type {};
+
+    template<typename It>
+    struct is_ring_buffer_iterator<It, decltype(void(std::declval<typename It::container_type*>()))> : std::true_type {};
+
+    template<typename It>
+    using is_random_access = std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>;
+
+    /// @brief Gets the iterator pointing to ptr which is in the segments of [first, last).
+    template<typename It, typename Segments, typename Ptr>
+    It _fromSegments(It first, const Segments& segs, Ptr ptr)
+    {
+        if (ptr >= segs.first.begin() && ptr < segs.first.end())
+        {
+            return first + (ptr - segs.first.begin());
+        }
+        return first + (segs.first.size() + (ptr - segs.second.begin()));
+    }
+
+    template<typename InputIt, typename T>
+    InputIt _find(InputIt first, InputIt last, const T& value, std::false_type)
+    {
+        return std::find(first, last, value);
+    }
+
+    template<typename InputIt, typename T>
+    InputIt _find(InputIt first, InputIt last, const T& value, std::true_type)
+    {
+        const auto segs = first.getSegments(last);
+
+        auto found = std::find(segs.first.begin(), segs.first.end(), value);
+        if (found != segs.first.end())
+        {
+            return _fromSegments(first, segs, found);
+        }
+
+        found = std::find(segs.second.begin(), segs.second.end(), value);
+        if (found != segs.second.end())
+        {
+            return _fromSegments(first, segs, found);
+        }
+        return last;
+    }
+
+    /// @brief Finds the first element equal to value in [first, last).
+    /// @details Linear complexity. For ring_buffer iterators the search runs on at most two contiguous segments.
+    template<typename InputIt, typename T>
+    InputIt find(InputIt first, InputIt last, const T& value)
+    {
+        return _find(first, last, value, is_ring_buffer_iterator<InputIt>{});
+    }
+
+    template<typename InputIt, typename T>
+    typename std::iterator_traits<InputIt>::difference_type _count(InputIt first, InputIt last, const T& value, std::false_type)
+    {
+        return std::count(first, last, value);
+    }
+
+    template<typename InputIt, typename T>
+    typename std::iterator_traits<InputIt>::difference_type _count(InputIt first, InputIt last, const T& value, std::true_type)
+    {
+        const auto segs = first.getSegments(last);
+        return std::count(segs.first.begin(), segs.first.end(), value) + std::count(segs.second.begin(), segs.second.end(), value);
+    }
+
+    /// @brief Counts the elements equal to value in [first, last).
+    /// @details Linear complexity. For ring_buffer iterators the count runs on at most two contiguous segments.
+    template<typename InputIt, typename T>
+    typename std::iterator_traits<InputIt>::difference_type count(InputIt first, InputIt last, const T& value)
+    {
+        return _count(first, last, value, is_ring_buffer_iterator<InputIt>{});
+    }
+
+    template<typename ForwardIt, typename T>
+    void _fill(ForwardIt first, ForwardIt last, const T& value, std::false_type)
+    {
+        std::fill(first, last, value);
+    }
+
+    template<typename ForwardIt, typename T>
+    void _fill(ForwardIt first, ForwardIt last, const T& value, std::true_type)
+    {
+        const auto segs = first.getSegments(last);
+        std::fill(segs.first.begin(), segs.first.end(), value);
+        std::fill(segs.second.begin(), segs.second.end(), value);
+    }
+
+    /// @brief Assigns value to every element in [first, last).
+    /// @details Linear complexity. For ring_buffer iterators the assignment runs on at most two contiguous segments, which reaches memset for byte sized types.
+    template<typename ForwardIt, typename T>
+    void fill(ForwardIt first, ForwardIt last, const T& value)
+    {
+        _fill(first, last, value, is_ring_buffer_iterator<ForwardIt>{});
+    }
+
+    template<typename InputIt, typename UnaryFunction>
+    UnaryFunction _for_each(InputIt first, InputIt last, UnaryFunction f, std::false_type)
+    {
+        return std::for_each(first, last, std::move(f));
+    }
+
+    template<typename InputIt, typename UnaryFunction>
+    UnaryFunction _for_each(InputIt first, InputIt last, UnaryFunction f, std::true_type)
+    {
+        const auto segs = first.getSegments(last);
+        return std::for_each(segs.second.begin(), segs.second.end(), std::for_each(segs.first.begin(), segs.first.end(), std::move(f)));
+    }
+
+    /// @brief Applies f to every element in [first, last) in order.
+    /// @details Linear complexity. For ring_buffer iterators the loop runs on at most two contiguous segments.
+    template<typename InputIt, typename UnaryFunction>
+    UnaryFunction for_each(InputIt first, InputIt last, UnaryFunction f)
+    {
+        return _for_each(first, last, std::move(f), is_ring_buffer_iterator<InputIt>{});
+    }
+
+    template<typename InputIt, typename T>
+    T _accumulate(InputIt first, InputIt last, T init, std::false_type)
+    {
+        return std::accumulate(first, last, std::move(init));
+    }
+
+    template<typename InputIt, typename T>
+    T _accumulate(InputIt first, InputIt last, T init, std::true_type)
+    {
+        const auto segs = first.getSegments(last);
+        init = std::accumulate(segs.first.begin(), segs.first.end(), std::move(init));
+        return std::accumulate(segs.second.begin(), segs.second.end(), std::move(init));
+    }
+
+    /// @brief Sums init and the elements in [first, last) in order.
+    /// @details Linear complexity. For ring_buffer iterators the sum runs on at most two contiguous segments.
+    template<typename InputIt, typename T>
+    T accumulate(InputIt first, InputIt last, T init)
+    {
+        return _accumulate(first, last, std::move(init), is_ring_buffer_iterator<InputIt>{});
+    }
+
+    // Runs op(sourceBegin, sourceEnd, destination) on destination segments when the destination is a ring_buffer iterator and the source
+    // is a random access range. Otherwise op runs once on the whole range.
+    template<typename InputIt, typename OutputIt, typename Op>
+    OutputIt _toSegments(InputIt first, InputIt last, OutputIt dest, Op op, std::false_type)
+    {
+        return op(first, last, dest);
+    }
+
+    template<typename InputIt, typename OutputIt, typename Op>
+    OutputIt _toSegments(InputIt first, InputIt last, OutputIt dest, Op op, std::true_type)
+    {
+        const auto destEnd = dest + std::distance(first, last);
+        const auto segs = dest.getSegments(destEnd);
+        const auto mid = first + segs.first.size();
+
+        op(first, mid, segs.first.begin());
+        op(mid, last, segs.second.begin());
+        return destEnd;
+    }
+
+    template<typename InputIt, typename OutputIt, typename Op>
+    OutputIt _copySegments(InputIt first, InputIt last, OutputIt dest, Op op, std::false_type)
+    {
+        using split = std::integral_constant<bool, is_ring_buffer_iterator<OutputIt>::value && is_random_access<InputIt>::value>;
+        return _toSegments(first, last, dest, op, split{});
+    }
+
+    template<typename InputIt, typename OutputIt, typename Op>
+    OutputIt _copySegments(InputIt first, InputIt last, OutputIt dest, Op op, std::true_type)
+    {
+        using split = std::integral_constant<bool, is_ring_buffer_iterator<OutputIt>::value>;
+        const auto segs = first.getSegments(last);
+        dest = _toSegments(segs.first.begin(), segs.first.end(), dest, op, split{});
+        return _toSegments(segs.second.begin(), segs.second.end(), dest, op, split{});
+    }
+
+    /// @brief Copies [first, last) to the range beginning at dest.
+    /// @details Linear complexity. Both source and destination ring_buffer ranges are split into contiguous segments, so trivially copyable types are copied with memmove.
+    template<typename InputIt, typename OutputIt>
+    OutputIt copy(InputIt first, InputIt last, OutputIt dest)
+    {
+        return _copySegments(first, last, dest, [](auto b, auto e, auto d) { return std::copy(b, e, d); }, is_ring_buffer_iterator<InputIt>{});
+    }
+
+    /// @brief Applies op to every element in [first, last) and stores the results to the range beginning at dest.
+    /// @details Linear complexity. Both source and destination ring_buffer ranges are split into contiguous segments.
+    template<typename InputIt, typename OutputIt, typename UnaryOperation>
+    OutputIt transform(InputIt first, InputIt last, OutputIt dest, UnaryOperation op)
+    {
+        return _copySegments(first, last, dest, [&op](auto b, auto e, auto d) { return std::transform(b, e, d, op); }, is_ring_buffer_iterator<InputIt>{});
+    }
+
+    template<typename InputIt1, typename InputIt2>
+    bool _equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, std::false_type)
+    {
+        return std::equal(first1, last1, first2);
+    }
+
+    template<typename InputIt1, typename InputIt2>
+    bool _equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, std::true_type)
+    {
+        const auto segs = first2.getSegments(first2 + std::distance(first1, last1));
+        const auto mid1 = first1 + segs.first.size();
+        return std::equal(first1, mid1, segs.first.begin()) && std::equal(mid1, last1, segs.second.begin());
+    }
+
+    template<typename InputIt1, typename InputIt2>
+    bool _equalSegments(InputIt1 first1, InputIt1 last1, InputIt2 first2, std::false_type)
+    {
+        using split = std::integral_constant<bool, is_ring_buffer_iterator<InputIt2>::value && is_random_access<InputIt1>::value>;
+        return _equal(first1, last1, first2, split{});
+    }
+
+    template<typename InputIt1, typename InputIt2>
+    bool _equalSegments(InputIt1 first1, InputIt1 last1, InputIt2 first2, std::true_type)
+    {
+        using split = std::integral_constant<bool, is_ring_buffer_iterator<InputIt2>::value>;
+        const auto segs = first1.getSegments(last1);
+        if (!_equal(segs.first.begin(), segs.first.end(), first2, split{}))
+        {
+            return false;
+        }
+        std::advance(first2, segs.first.size());
+        return _equal(segs.second.begin(), segs.second.end(), first2, split{});
+    }
+
+    /// @brief Checks if [first1, last1) is equal to the range beginning at first2.
+    /// @details Linear complexity. Both ring_buffer ranges are split into contiguous segments.
+    template<typename InputIt1, typename InputIt2>
+    bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2)
+    {
+        return _equalSegments(first1, last1, first2, is_ring_buffer_iterator<InputIt1>{});
+    }
+}
+
+/// @brief Ring buffer which keeps its capacity at a power of two and wraps indices with a bitmask.
+/// @tparam T Type of the elements.
+/// @tparam Allocator Allocator used for (de)allocation and (de)construction. Defaults to std::allocator<T>
+template<typename T, typename Allocator = std::allocator<T>>
+using pow2_ring_buffer = ring_buffer<T, Allocator, pow2_capacity_policy>;
+
+//===========================
+// Chunked ring buffer
+//===========================
+
+namespace
+{
+    // Chunk size of about a page, rounded down to a power of two and at least 16 elements.
+    constexpr size_t _default_chunk_size(size_t elementSize) noexcept
+    {
+        size_t size = 16;
+        while (size * 2 * elementSize <= 4096)
+        {
+            size *= 2;
+        }
+        return size;
+    }
+}
+
+/// @brief Random access iterator holding the container and the logical index of the element. Used by the containers whose elements are not in one or two contiguous segments.
+/// @tparam Container Container type. Elements are accessed with its operator[].
+/// @tparam IsConst True for const_iterator.
+template<typename Container, bool IsConst>
+class _indexed_iterator
+{
+    using container_type = std::conditional_t<IsConst, const Container, Container>;
+
+public:
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename Container::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+    using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+    _indexed_iterator() noexcept : m_container(nullptr), m_index(0) {}
+
+    _indexed_iterator(container_type* container, difference_type index) noexcept : m_container(container), m_index(index) {}
+
+    /// @brief Converts an iterator to a const_iterator.
+    template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+    _indexed_iterator(const _indexed_iterator<Container, OtherConst>& other) noexcept : m_container(other.m_container), m_index(other.m_index) {}
+
+    reference operator*() const noexcept { return (*m_container)[m_index]; }
+    pointer operator->() const noexcept { return std::addressof(**this); }
+    reference operator[](difference_type offset) const noexcept { return (*m_container)[m_index + offset]; }
+
+    _indexed_iterator& operator++() noexcept { ++m_index; return *this; }
+    _indexed_iterator operator++(int) noexcept { auto temp = *this; ++m_index; return temp; }
+    _indexed_iterator& operator--() noexcept { --m_index; return *this; }
+    _indexed_iterator operator--(int) noexcept { auto temp = *this; --m_index; return temp; }
+
+    _indexed_iterator& operator+=(difference_type offset) noexcept { m_index += offset; return *this; }
+    _indexed_iterator& operator-=(difference_type offset) noexcept { m_index -= offset; return *this; }
+    _indexed_iterator operator+(difference_type offset) const noexcept { return _indexed_iterator(m_container, m_index + offset); }
+    _indexed_iterator operator-(difference_type offset) const noexcept { return _indexed_iterator(m_container, m_index - offset); }
+    friend _indexed_iterator operator+(difference_type offset, const _indexed_iterator& it) noexcept { return it + offset; }
+
+    // Friends, so that an iterator converts to a const_iterator on either side.
+    friend difference_type operator-(const _indexed_iterator& lhs, const _indexed_iterator& rhs) noexcept { return lhs.m_index - rhs.m_index; }
+    friend bool operator==(const _indexed_iterator& lhs, const _indexed_iterator& rhs) noexcept { return lhs.m_index == rhs.m_index; }
+    friend bool operator!=(const _indexed_iterator& lhs, const _indexed_iterator& rhs) noexcept { return lhs.m_index != rhs.m_index; }
+    friend bool operator<(const _indexed_iterator& lhs, const _indexed_iterator& rhs) noexcept { return lhs.m_index < rhs.m_index; }
+    friend bool operator>(const _indexed_iterator& lhs, const _indexed_iterator& rhs) noexcept { return lhs.m_index > rhs.m_index; }
+    friend bool operator<=(const _indexed_iterator& lhs, const _indexed_iterator& rhs) noexcept { return lhs.m_index <= rhs.m_index; }
+    friend bool operator>=(const _indexed_iterator& lhs, const _indexed_iterator& rhs) noexcept { return lhs.m_index >= rhs.m_index; }
+
+private:
+
+    friend class _indexed_iterator<Container, !IsConst>;
+
+    container_type* m_container;  /*!< Container of the element.*/
+
+    difference_type m_index;  /*!< Logical index of the element.*/
+};
+
+/// @brief Ring buffer that stores its elements in fixed size chunks referenced by a ring_buffer of chunk pointers.
+/// @details Elements never move once constructed, so growing only allocates a chunk and grows the ring of chunk pointers, which is linear in the amount of chunks.
+/// Chunks emptied by pop_front are moved to the back of the ring and reused, so a buffer used as a queue stops allocating once it reaches its largest size.
+/// Position p of an element, counted from the start of the first chunk, is found in chunk p / ChunkSize at p % ChunkSize, which compile to a shift and a mask.
+/// @note push and pop keep pointers and references to the other elements valid. Iterators are indices, so push_front and pop_front invalidate them.
+/// @tparam T Type of the elements.
+/// @tparam Allocator Allocator used for (de)allocation and (de)construction of the elements. Defaults to std::allocator<T>.
+/// @tparam ChunkSize Amount of elements per chunk. Must be a power of two. Defaults to about 4 KiB of elements.
+template<typename T, typename Allocator = std::allocator<T>, size_t ChunkSize = _default_chunk_size(sizeof(T))>
+class chunked_ring_buffer : private _allocator_storage<Allocator>
+{
+    static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be a power of two.");
+
+    using storage = _allocator_storage<Allocator>;
+
+public:
+
+    using value_type = T;
+    using allocator_type = Allocator;
+    using alloc_traits = std::allocator_traits<allocator_type>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    /// @brief Ring of chunk pointers. Indexed with a bitmask like the elements.
+    using chunk_ring = ring_buffer<pointer, typename alloc_traits::template rebind_alloc<pointer>, pow2_capacity_policy, pow2_growth_policy>;
+
+    static constexpr size_type chunk_size = ChunkSize;
+
+    using iterator = _indexed_iterator<chunked_ring_buffer, false>;
+    using const_iterator = _indexed_iterator<chunked_ring_buffer, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// @brief Default constructor. Allocates nothing.
+    /// @details Constant complexity.
+    chunked_ring_buffer() : chunked_ring_buffer(allocator_type()) {}
+
+    /// @brief Constructor with custom allocator. Allocates nothing.
+    /// @param alloc Allocator for the elements. The ring of chunk pointers uses a rebound copy.
+    /// @details Constant complexity.
+    explicit chunked_ring_buffer(const allocator_type& alloc) : storage(alloc), m_chunks(typename chunk_ring::allocator_type(alloc)), m_offset(0), m_size(0) {}
+
+    /// @brief Constructs a buffer with count value-initialized elements.
+    /// @param count Amount of elements.
+    /// @param alloc Allocator for the elements.
+    /// @throw Can throw std::bad_alloc or something from T's constructor.
+    /// @details Linear complexity in relation to count.
+    explicit chunked_ring_buffer(size_type count, const allocator_type& alloc = allocator_type()) : chunked_ring_buffer(alloc)
+    {
+        reserve(count);
+        for (size_type i = 0; i < count; i++)
+        {
+            emplace_back();
+        }
+    }
+
+    /// @brief Copy constructor.
+    /// @param rhs Buffer to copy.
+    /// @throw Can throw std::bad_alloc or something from T's copy constructor.
+    /// @details Linear complexity in relation to the size of rhs.
+    chunked_ring_buffer(const chunked_ring_buffer& rhs) : chunked_ring_buffer(alloc_traits::select_on_container_copy_construction(rhs._allocator()))
+    {
+        reserve(rhs.size());
+        for (const auto& value : rhs)
+        {
+            emplace_back(value);
+        }
+    }
+
+    /// @brief Move constructor. Takes the chunks of other.
+    /// @param other Buffer to move from. Left empty without chunks.
+    /// @details Constant complexity.
+    chunked_ring_buffer(chunked_ring_buffer&& other) noexcept
+        : storage(std::move(other._allocator())), m_chunks(std::move(other.m_chunks)), m_offset(std::exchange(other.m_offset, 0)), m_size(std::exchange(other.m_size, 0))
+    {
+    }
+
+    /// @brief Destructor. Destroys the elements and releases all chunks.
+    ~chunked_ring_buffer()
+    {
+        clear();
+        _releaseChunks(m_chunks.size());
+    }
+
+    /// @brief Copy assignment operator.
+    /// @param other Buffer to copy.
+    /// @return Reference to this buffer.
+    /// @exception If any exception is thrown, this buffer is left unchanged (Strong exception guarantee).
+    /// @details Linear complexity in relation to the sizes of both buffers.
+    chunked_ring_buffer& operator=(const chunked_ring_buffer& other)
+    {
+        if (this != &other)
+        {
+            chunked_ring_buffer temp(other, alloc_traits::propagate_on_container_copy_assignment::value ? other._allocator() : storage::_allocator());
+            if (alloc_traits::propagate_on_container_copy_assignment::value)
+            {
+                std::swap(storage::_allocator(), temp._allocator());
+            }
+            _swapContents(temp);
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator. Takes the chunks of other if the allocators allow it, otherwise moves the elements.
+    /// @param other Buffer to move from.
+    /// @return Reference to this buffer.
+    /// @details Constant complexity if the chunks are taken, otherwise linear complexity in relation to the size of other.
+    chunked_ring_buffer& operator=(chunked_ring_buffer&& other)
+    {
+        if (alloc_traits::propagate_on_container_move_assignment::value || storage::_allocator() == other._allocator())
+        {
+            chunked_ring_buffer temp(std::move(other));
+            if (alloc_traits::propagate_on_container_move_assignment::value)
+            {
+                std::swap(storage::_allocator(), temp._allocator());
+            }
+            _swapContents(temp);
+        }
+        else
+        {
+            clear();
+            reserve(other.size());
+            for (auto& value : other)
+            {
+                emplace_back(std::move(value));
+            }
+            other.clear();
+        }
+        return *this;
+    }
+
+    /// @brief Constructs an element in place to the back of the buffer. Allocates a chunk if the last chunk is full and no spare chunk is left.
+    /// @param args Arguments to construct value_type from.
+    /// @throw Can throw std::bad_alloc or something from T's constructor.
+    /// @exception If any exception is thrown, the elements are not modified (Strong exception guarantee). An allocated chunk is kept as a spare.
+    /// @details Constant complexity, or linear in the amount of chunks if the ring of chunk pointers grows. Existing elements are never moved.
+    template<class... Args>
+    void emplace_back(Args&&... args)
+    {
+        const auto position = m_offset + m_size;
+        if (position == m_chunks.size() * ChunkSize)
+        {
+            _appendChunk();
+        }
+
+        alloc_traits::construct(storage::_allocator(), _address(position), std::forward<Args>(args)...);
+        ++m_size;
+    }
+
+    /// @brief Constructs an element in place to the front of the buffer. Takes a spare chunk from the back or allocates one if the first chunk is full.
+    /// @param args Arguments to construct value_type from.
+    /// @throw Can throw std::bad_alloc or something from T's constructor.
+    /// @exception If any exception is thrown, function has no effect (Strong exception guarantee).
+    /// @details Constant complexity, or linear in the amount of chunks if the ring of chunk pointers grows. Existing elements are never moved.
+    template<class... Args>
+    void emplace_front(Args&&... args)
+    {
+        if (m_offset == 0)
+        {
+            _prependChunk(std::forward<Args>(args)...);
+        }
+        else
+        {
+            alloc_traits::construct(storage::_allocator(), _address(m_offset - 1), std::forward<Args>(args)...);
+            --m_offset;
+        }
+        ++m_size;
+    }
+
+    /// @brief Copies an element to the back of the buffer.
+    /// @param value Element to insert.
+    /// @details Constant complexity apart from growing the ring of chunk pointers.
+    void push_back(const value_type& value)
+    {
+        emplace_back(value);
+    }
+
+    /// @brief Moves an element to the back of the buffer.
+    /// @param value Element to insert.
+    /// @details Constant complexity apart from growing the ring of chunk pointers.
+    void push_back(value_type&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    /// @brief Copies an element to the front of the buffer.
+    /// @param value Element to insert.
+    /// @details Constant complexity apart from growing the ring of chunk pointers.
+    void push_front(const value_type& value)
+    {
+        emplace_front(value);
+    }
+
+    /// @brief Moves an element to the front of the buffer.
+    /// @param value Element to insert.
+    /// @details Constant complexity apart from growing the ring of chunk pointers.
+    void push_front(value_type&& value)
+    {
+        emplace_front(std::move(value));
+    }
+
+    /// @brief Removes the first element. A chunk emptied by the removal is moved to the back of the ring for reuse.
+    /// @pre The buffer is not empty.
+    /// @details Constant complexity.
+    void pop_front() noexcept
+    {
+        alloc_traits::destroy(storage::_allocator(), _address(m_offset));
+        --m_size;
+
+        if (++m_offset == ChunkSize)
+        {
+            // The ring has room for the chunk after popping it, so pushing does not allocate.
+            const auto chunk = m_chunks.front();
+            m_chunks.pop_front();
+            m_chunks.push_back(chunk);
+            m_offset = 0;
+        }
+    }
+
+    /// @brief Removes the last element. The chunk is kept as a spare.
+    /// @pre The buffer is not empty.
+    /// @details Constant complexity.
+    void pop_back() noexcept
+    {
+        --m_size;
+        alloc_traits::destroy(storage::_allocator(), _address(m_offset + m_size));
+    }
+
+    /// @brief Index operator.
+    /// @param logicalIndex Index of the element. Must be less than size().
+    /// @details Constant complexity.
+    reference operator[](size_type logicalIndex) noexcept
+    {
+        return *_address(m_offset + logicalIndex);
+    }
+
+    /// @brief Index operator.
+    /// @param logicalIndex Index of the element. Must be less than size().
+    /// @details Constant complexity.
+    const_reference operator[](size_type logicalIndex) const noexcept
+    {
+        return *_address(m_offset + logicalIndex);
+    }
+
+    /// @brief Gets an element with bounds checking.
+    /// @param logicalIndex Index of the element.
+    /// @throw Throws std::out_of_range if logicalIndex >= size().
+    /// @details Constant complexity.
+    reference at(size_type logicalIndex)
+    {
+        if (logicalIndex >= size())
+        {
+            throw std::out_of_range("Index is out of range");
+        }
+        return (*this)[logicalIndex];
+    }
+
+    /// @brief Gets an element with bounds checking.
+    /// @param logicalIndex Index of the element.
+    /// @throw Throws std::out_of_range if logicalIndex >= size().
+    /// @details Constant complexity.
+    const_reference at(size_type logicalIndex) const
+    {
+        if (logicalIndex >= size())
+        {
+            throw std::out_of_range("Index is out of range");
+        }
+        return (*this)[logicalIndex];
+    }
+
+    /// @brief Returns a reference to the first element. Behaviour is undefined for empty buffer.
+    /// @details Constant complexity.
+    reference front() noexcept { return (*this)[0]; }
+
+    /// @brief Returns a reference to the first element. Behaviour is undefined for empty buffer.
+    /// @details Constant complexity.
+    const_reference front() const noexcept { return (*this)[0]; }
+
+    /// @brief Returns a reference to the last element. Behaviour is undefined for empty buffer.
+    /// @details Constant complexity.
+    reference back() noexcept { return (*this)[m_size - 1]; }
+
+    /// @brief Returns a reference to the last element. Behaviour is undefined for empty buffer.
+    /// @details Constant complexity.
+    const_reference back() const noexcept { return (*this)[m_size - 1]; }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return iterator(this, size()); }
+    const_iterator end() const noexcept { return const_iterator(this, size()); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /// @brief Gets the size of the buffer.
+    /// @details Constant complexity.
+    size_type size() const noexcept { return m_size; }
+
+    /// @brief Check if buffer is empty.
+    /// @details Constant complexity.
+    bool empty() const noexcept { return m_size == 0; }
+
+    /// @brief Gets the theoretical maximum size of the buffer.
+    /// @details Constant complexity.
+    size_type max_size() const noexcept { return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+    /// @brief Gets how many elements fit in the buffer before push_back needs to allocate a chunk.
+    /// @details Constant complexity.
+    size_type capacity() const noexcept { return m_chunks.size() * ChunkSize - m_offset; }
+
+    /// @brief Gets the amount of allocated chunks, including spare chunks.
+    /// @details Constant complexity.
+    size_type chunk_count() const noexcept { return m_chunks.size(); }
+
+    /// @brief Allocator getter.
+    /// @details Constant complexity.
+    allocator_type get_allocator() const noexcept { return storage::_allocator(); }
+
+    /// @brief Allocates chunks to the back until capacity() >= newCapacity. Elements are not moved.
+    /// @param newCapacity Requested capacity.
+    /// @throw Can throw std::bad_alloc.
+    /// @exception Chunks allocated before an exception are kept as spares, elements are not modified.
+    /// @details Linear complexity in relation to the amount of chunks.
+    void reserve(size_type newCapacity)
+    {
+        if (newCapacity <= capacity()) return;
+
+        const auto chunks = (newCapacity + m_offset + ChunkSize - 1) / ChunkSize;
+        m_chunks.reserve(chunks);
+        while (m_chunks.size() < chunks)
+        {
+            _appendChunk();
+        }
+    }
+
+    /// @brief Releases the spare chunks after the last element. An empty buffer releases all of its memory.
+    /// @throw Can throw std::bad_alloc if the ring of chunk pointers is shrunk.
+    /// @details Linear complexity in relation to the amount of chunks.
+    void shrink_to_fit()
+    {
+        if (empty())
+        {
+            m_offset = 0;
+        }
+        _releaseChunks(m_chunks.size() - _usedChunks());
+        m_chunks.shrink_to_fit();
+    }
+
+    /// @brief Destroys all elements. The chunks are kept.
+    /// @details Linear complexity in relation to size, constant for trivially destructible types.
+    void clear() noexcept
+    {
+        if (!std::is_trivially_destructible<T>::value || !_has_default_construct<Allocator>::value)
+        {
+            for (size_type i = 0; i < m_size; i++)
+            {
+                alloc_traits::destroy(storage::_allocator(), _address(m_offset + i));
+            }
+        }
+        m_size = 0;
+        m_offset = 0;
+    }
+
+    /// @brief Swaps the contents of two buffers.
+    /// @param other Buffer to swap with.
+    /// @details Constant complexity.
+    void swap(chunked_ring_buffer& other) noexcept
+    {
+        if (alloc_traits::propagate_on_container_swap::value)
+        {
+            std::swap(storage::_allocator(), other._allocator());
+        }
+        _swapContents(other);
+    }
+
+    /// @brief Friend swap.
+    /// @details Constant complexity.
+    friend void swap(chunked_ring_buffer& a, chunked_ring_buffer& b) noexcept
+    {
+        a.swap(b);
+    }
+
+private:
+
+    chunked_ring_buffer(const chunked_ring_buffer& rhs, const allocator_type& alloc) : chunked_ring_buffer(alloc)
+    {
+        reserve(rhs.size());
+        for (const auto& value : rhs)
+        {
+            emplace_back(value);
+        }
+    }
+
+    /// @brief Gets the address of a position counted from the start of the first chunk.
+    /// @details Constant complexity. ChunkSize is a power of two, so the division and modulo compile to a shift and a mask.
+    pointer _address(size_type position) const noexcept
+    {
+        return m_chunks[position / ChunkSize] + position % ChunkSize;
+    }
+
+    size_type _usedChunks() const noexcept
+    {
+        return m_size == 0 ? 0 : (m_offset + m_size - 1) / ChunkSize + 1;
+    }
+
+    void _swapContents(chunked_ring_buffer& other) noexcept
+    {
+        m_chunks.swap(other.m_chunks);
+        std::swap(m_offset, other.m_offset);
+        std::swap(m_size, other.m_size);
+    }
+
+    pointer _allocateChunk()
+    {
+        return alloc_traits::allocate(storage::_allocator(), ChunkSize);
+    }
+
+    /// @brief Allocates a chunk to the back of the ring.
+    /// @exception If any exception is thrown, function has no effect (Strong exception guarantee).
+    void _appendChunk()
+    {
+        const auto chunk = _allocateChunk();
+        try
+        {
+            m_chunks.push_back(chunk);
+        }
+        catch (...)
+        {
+            alloc_traits::deallocate(storage::_allocator(), chunk, ChunkSize);
+            throw;
+        }
+    }
+
+    /// @brief Constructs an element to the last slot of a new first chunk, which is a spare chunk from the back or a newly allocated one.
+    /// @exception If any exception is thrown, function has no effect (Strong exception guarantee).
+    template<class... Args>
+    void _prependChunk(Args&&... args)
+    {
+        if (m_chunks.size() > _usedChunks())
+        {
+            // The last chunk holds no elements. The ring has room for it after popping it, so pushing does not allocate.
+            const auto chunk = m_chunks.back();
+            alloc_traits::construct(storage::_allocator(), chunk + ChunkSize - 1, std::forward<Args>(args)...);
+            m_chunks.pop_back();
+            m_chunks.push_front(chunk);
+        }
+        else
+        {
+            const auto chunk = _allocateChunk();
+            try
+            {
+                alloc_traits::construct(storage::_allocator(), chunk + ChunkSize - 1, std::forward<Args>(args)...);
+                try
+                {
+                    m_chunks.push_front(chunk);
+                }
+                catch (...)
+                {
+                    alloc_traits::destroy(storage::_allocator(), chunk + ChunkSize - 1);
+                    throw;
+                }
+            }
+            catch (...)
+            {
+                alloc_traits::deallocate(storage::_allocator(), chunk, ChunkSize);
+                throw;
+            }
+        }
+        m_offset = ChunkSize - 1;
+    }
+
+    /// @brief Releases chunks from the back of the ring.
+    /// @param count Amount of chunks to release. Must not hold elements.
+    void _releaseChunks(size_type count) noexcept
+    {
+        for (; count > 0; --count)
+        {
+            alloc_traits::deallocate(storage::_allocator(), m_chunks.back(), ChunkSize);
+            m_chunks.pop_back();
+        }
+    }
+
+    chunk_ring m_chunks;  /*!< Pointers to the chunks. Chunks after the last element are spares.*/
+
+    size_type m_offset;  /*!< Position of the first element in the first chunk.*/
+
+    size_type m_size;  /*!< Amount of elements.*/
+};
+
+/// @brief Equality comparator. Compares buffers element-to-element.
+/// @param lhs Left hand side operand.
+/// @param rhs Right hand side operand.
+/// @return True if the buffers have the same size and their elements compare equal.
+template<typename T, typename Alloc, size_t ChunkSize>
+inline bool operator==(const chunked_ring_buffer<T,Alloc,ChunkSize>& lhs, const chunked_ring_buffer<T,Alloc,ChunkSize>& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+/// @brief Not-equal comparator. Compares buffers element-to-element.
+/// @param lhs Left hand side operand.
+/// @param rhs Right hand side operand.
+/// @return True if any of the elements are not equal.
+template<typename T, typename Alloc, size_t ChunkSize>
+inline bool operator!=(const chunked_ring_buffer<T,Alloc,ChunkSize>& lhs, const chunked_ring_buffer<T,Alloc,ChunkSize>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+//===========================
+// Ring span
+//===========================
+
+/// @brief Non-owning ring over memory provided by the caller, such as a stack array, a shared memory segment or a preallocated slab.
+/// @details Never allocates or frees memory and never constructs or destroys elements. All capacity() slots hold live objects, pushing assigns to a slot
+/// and popping only moves the indices, so the popped element stays in its slot until it is overwritten. The index logic is the same as in ring_buffer.
+/// @note Memory that holds no objects yet, for example from malloc or mmap, may be used directly for trivial types.
+/// @tparam T Type of the elements.
+/// @tparam CapacityPolicy Policy that wraps physical indices. With pow2_capacity_policy the capacity must be a power of two.
+/// @tparam OverflowPolicy reject_overflow_policy (default) throws std::length_error when pushing to a full span, overwrite_overflow_policy replaces the element at the opposite end.
+template<typename T, typename CapacityPolicy = default_capacity_policy, typename OverflowPolicy = reject_overflow_policy>
+class ring_span
+{
+    static_assert(std::is_same<OverflowPolicy, reject_overflow_policy>::value || std::is_same<OverflowPolicy, overwrite_overflow_policy>::value,
+        "ring_span can not grow, OverflowPolicy must be reject_overflow_policy or overwrite_overflow_policy.");
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using capacity_policy = CapacityPolicy;
+    using overflow_policy = OverflowPolicy;
+
+    using iterator = _indexed_iterator<ring_span, false>;
+    using const_iterator = _indexed_iterator<ring_span, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    using span = ring_buffer_span<value_type>;
+    using const_span = ring_buffer_span<const value_type>;
+
+    /// @brief Constructs a span without memory. Every push overflows.
+    /// @details Constant complexity.
+    ring_span() noexcept : m_data(nullptr), m_capacity(0), m_size(0), m_tailIndex(0) {}
+
+    /// @brief Constructs a span over a memory block.
+    /// @param data Pointer to capacity objects of type T.
+    /// @param capacity Amount of objects in the block.
+    /// @param size Amount of objects at the beginning of the block that are the initial elements of the span. Must not be larger than capacity.
+    /// @details Constant complexity.
+    ring_span(pointer data, size_type capacity, size_type size = 0) noexcept : m_data(data), m_capacity(capacity), m_size(size), m_tailIndex(0) {}
+
+    /// @brief Constructs an empty span over an array.
+    /// @param array Array of objects to use as the memory.
+    /// @details Constant complexity.
+    template<size_t N>
+    explicit ring_span(T (&array)[N]) noexcept : ring_span(array, N) {}
+
+    /// @brief Assigns value to the slot after the last element. If the span is full, the OverflowPolicy decides whether std::length_error is thrown or the first element is overwritten.
+    /// @param value Value to copy.
+    /// @throw Throws std::length_error if the span is full and rejects elements. Can also throw from T's copy assignment.
+    /// @details Constant complexity.
+    void push_back(const value_type& value)
+    {
+        _pushBack(value);
+    }
+
+    /// @brief Move assigns value to the slot after the last element. If the span is full, the OverflowPolicy decides whether std::length_error is thrown or the first element is overwritten.
+    /// @param value Value to move.
+    /// @details Constant complexity.
+    void push_back(value_type&& value)
+    {
+        _pushBack(std::move(value));
+    }
+
+    /// @brief Assigns value to the slot before the first element. If the span is full, the OverflowPolicy decides whether std::length_error is thrown or the last element is overwritten.
+    /// @param value Value to copy.
+    /// @throw Throws std::length_error if the span is full and rejects elements. Can also throw from T's copy assignment.
+    /// @details Constant complexity.
+    void push_front(const value_type& value)
+    {
+        _pushFront(value);
+    }
+
+    /// @brief Move assigns value to the slot before the first element. If the span is full, the OverflowPolicy decides whether std::length_error is thrown or the last element is overwritten.
+    /// @param value Value to move.
+    /// @details Constant complexity.
+    void push_front(value_type&& value)
+    {
+        _pushFront(std::move(value));
+    }
+
+    /// @brief Constructs a temporary from args and move assigns it after the last element, like push_back.
+    /// @param args Arguments to construct value_type from.
+    /// @details Constant complexity.
+    template<class... Args>
+    void emplace_back(Args&&... args)
+    {
+        _pushBack(value_type(std::forward<Args>(args)...));
+    }
+
+    /// @brief Constructs a temporary from args and move assigns it before the first element, like push_front.
+    /// @param args Arguments to construct value_type from.
+    /// @details Constant complexity.
+    template<class... Args>
+    void emplace_front(Args&&... args)
+    {
+        _pushFront(value_type(std::forward<Args>(args)...));
+    }
+
+    /// @brief Assigns value after the last element if the span is not full, regardless of the OverflowPolicy.
+    /// @param value Value to copy.
+    /// @return True if the element was added, false if the span is full.
+    /// @details Constant complexity.
+    bool try_push_back(const value_type& value)
+    {
+        if (full()) return false;
+        _assignBack(value);
+        return true;
+    }
+
+    /// @brief Move assigns value after the last element if the span is not full, regardless of the OverflowPolicy.
+    /// @param value Value to move. Left untouched if the span is full.
+    /// @return True if the element was added, false if the span is full.
+    /// @details Constant complexity.
+    bool try_push_back(value_type&& value)
+    {
+        if (full()) return false;
+        _assignBack(std::move(value));
+        return true;
+    }
+
+    /// @brief Removes the first element. The object stays in its slot until it is overwritten.
+    /// @pre The span is not empty.
+    /// @details Constant complexity.
+    void pop_front() noexcept
+    {
+        m_tailIndex = CapacityPolicy::next(m_tailIndex, m_capacity);
+        --m_size;
+    }
+
+    /// @brief Removes the last element. The object stays in its slot until it is overwritten.
+    /// @pre The span is not empty.
+    /// @details Constant complexity.
+    void pop_back() noexcept
+    {
+        --m_size;
+    }
+
+    /// @brief Removes all elements. The objects stay in their slots.
+    /// @details Constant complexity.
+    void clear() noexcept
+    {
+        m_size = 0;
+        m_tailIndex = 0;
+    }
+
+    /// @brief Index operator.
+    /// @param logicalIndex Index of the element. Must be less than size().
+    /// @details Constant complexity.
+    reference operator[](size_type logicalIndex) noexcept
+    {
+        return m_data[CapacityPolicy::wrap(m_tailIndex + logicalIndex, m_capacity)];
+    }
+
+    /// @brief Index operator.
+    /// @param logicalIndex Index of the element. Must be less than size().
+    /// @details Constant complexity.
+    const_reference operator[](size_type logicalIndex) const noexcept
+    {
+        return m_data[CapacityPolicy::wrap(m_tailIndex + logicalIndex, m_capacity)];
+    }
+
+    /// @brief Gets an element with bounds checking.
+    /// @param logicalIndex Index of the element.
+    /// @throw Throws std::out_of_range if logicalIndex >= size().
+    /// @details Constant complexity.
+    reference at(size_type logicalIndex)
+    {
+        if (logicalIndex >= size())
+        {
+            throw std::out_of_range("Index is out of range");
+        }
+        return (*this)[logicalIndex];
+    }
+
+    /// @brief Gets an element with bounds checking.
+    /// @param logicalIndex Index of the element.
+    /// @throw Throws std::out_of_range if logicalIndex >= size().
+    /// @details Constant complexity.
+    const_reference at(size_type logicalIndex) const
+    {
+        if (logicalIndex >= size())
+        {
+            throw std::out_of_range("Index is out of range");
+        }
+        return (*this)[logicalIndex];
+    }
+
+    /// @brief Returns a reference to the first element. Behaviour is undefined for empty span.
+    /// @details Constant complexity.
+    reference front() noexcept { return m_data[m_tailIndex]; }
+
+    /// @brief Returns a reference to the first element. Behaviour is undefined for empty span.
+    /// @details Constant complexity.
+    const_reference front() const noexcept { return m_data[m_tailIndex]; }
+
+    /// @brief Returns a reference to the last element. Behaviour is undefined for empty span.
+    /// @details Constant complexity.
+    reference back() noexcept { return (*this)[m_size - 1]; }
+
+    /// @brief Returns a reference to the last element. Behaviour is undefined for empty span.
+    /// @details Constant complexity.
+    const_reference back() const noexcept { return (*this)[m_size - 1]; }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return iterator(this, size()); }
+    const_iterator end() const noexcept { return const_iterator(this, size()); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /// @brief Gets the elements as contiguous memory segments.
+    /// @return Pair of segments in logical order. The second segment is empty unless the elements wrap around the end of the memory.
+    /// @details Constant complexity.
+    std::pair<span, span> segments() noexcept
+    {
+        const auto firstCount = std::min(m_size, m_capacity - m_tailIndex);
+        return {span(m_data + m_tailIndex, firstCount), span(m_data, m_size - firstCount)};
+    }
+
+    /// @brief Gets the elements as contiguous read-only memory segments.
+    /// @return Pair of segments in logical order. The second segment is empty unless the elements wrap around the end of the memory.
+    /// @details Constant complexity.
+    std::pair<const_span, const_span> segments() const noexcept
+    {
+        auto segs = const_cast<ring_span*>(this)->segments();
+        return {const_span(segs.first.data(), segs.first.size()), const_span(segs.second.data(), segs.second.size())};
+    }
+
+    /// @brief Gets the memory block the span was constructed with.
+    /// @details Constant complexity.
+    pointer data() const noexcept { return m_data; }
+
+    /// @brief Gets the size of the span.
+    /// @details Constant complexity.
+    size_type size() const noexcept { return m_size; }
+
+    /// @brief Gets the amount of slots in the memory block.
+    /// @details Constant complexity.
+    size_type capacity() const noexcept { return m_capacity; }
+
+    /// @brief Gets the maximum size, which is the capacity.
+    /// @details Constant complexity.
+    size_type max_size() const noexcept { return m_capacity; }
+
+    /// @brief Check if span is empty.
+    /// @details Constant complexity.
+    bool empty() const noexcept { return m_size == 0; }
+
+    /// @brief Check if every slot holds an element. Pushing to a full span is handled by the OverflowPolicy.
+    /// @details Constant complexity.
+    bool full() const noexcept { return m_size == m_capacity; }
+
+    /// @brief Swaps the memory blocks and elements of two spans.
+    /// @details Constant complexity.
+    void swap(ring_span& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_size, other.m_size);
+        std::swap(m_tailIndex, other.m_tailIndex);
+    }
+
+    /// @brief Friend swap.
+    /// @details Constant complexity.
+    friend void swap(ring_span& a, ring_span& b) noexcept
+    {
+        a.swap(b);
+    }
+
+private:
+
+    size_type _headIndex() const noexcept
+    {
+        return CapacityPolicy::wrap(m_tailIndex + m_size, m_capacity);
+    }
+
+    template<typename U>
+    void _assignBack(U&& value)
+    {
+        m_data[_headIndex()] = std::forward<U>(value);
+        ++m_size;
+    }
+
+    template<typename U>
+    void _pushBack(U&& value)
+    {
+        if (full())
+        {
+            _overflowBack(OverflowPolicy(), std::forward<U>(value));
+            return;
+        }
+        _assignBack(std::forward<U>(value));
+    }
+
+    template<typename U>
+    void _pushFront(U&& value)
+    {
+        if (full())
+        {
+            _overflowFront(OverflowPolicy(), std::forward<U>(value));
+            return;
+        }
+        const auto newIndex = CapacityPolicy::prev(m_tailIndex, m_capacity);
+        m_data[newIndex] = std::forward<U>(value);
+        m_tailIndex = newIndex;
+        ++m_size;
+    }
+
+    template<typename U>
+    void _overflowBack(reject_overflow_policy, U&&)
+    {
+        throw std::length_error("ring_span is full");
+    }
+
+    template<typename U>
+    void _overflowFront(reject_overflow_policy, U&&)
+    {
+        throw std::length_error("ring_span is full");
+    }
+
+    // The slot of the first element is the slot after the last element, so it is overwritten and becomes the last slot.
+    template<typename U>
+    void _overflowBack(overwrite_overflow_policy, U&& value)
+    {
+        if (m_capacity == 0) return;
+
+        m_data[m_tailIndex] = std::forward<U>(value);
+        m_tailIndex = CapacityPolicy::next(m_tailIndex, m_capacity);
+    }
+
+    template<typename U>
+    void _overflowFront(overwrite_overflow_policy, U&& value)
+    {
+        if (m_capacity == 0) return;
+
+        const auto newIndex = CapacityPolicy::prev(m_tailIndex, m_capacity);
+        m_data[newIndex] = std::forward<U>(value);
+        m_tailIndex = newIndex;
+    }
+
+    pointer m_data;  /*!< Memory block provided by the caller. Not owned.*/
+
+    size_type m_capacity;  /*!< Amount of objects in the memory block.*/
+
+    size_type m_size;  /*!< Amount of elements in the span.*/
+
+    size_type m_tailIndex;  /*!< Index of the first element.*/
+};
+
+/// @brief Equality comparator. Compares spans element-to-element.
+/// @param lhs Left hand side operand.
+/// @param rhs Right hand side operand.
+/// @return True if the spans have the same size and their elements compare equal.
+template<typename T, typename Policy, typename Overflow>
+inline bool operator==(const ring_span<T,Policy,Overflow>& lhs, const ring_span<T,Policy,Overflow>& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+/// @brief Not-equal comparator. Compares spans element-to-element.
+/// @param lhs Left hand side operand.
+/// @param rhs Right hand side operand.
+/// @return True if any of the elements are not equal.
+template<typename T, typename Policy, typename Overflow>
+inline bool operator!=(const ring_span<T,Policy,Overflow>& lhs, const ring_span<T,Policy,Overflow>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+//===========================
+// Static ring buffer
+//===========================
+
+/// @brief Ring buffer with a compile-time capacity that keeps its elements inside the object. Never allocates.
+/// @details Elements are constructed when pushed and destroyed when popped, as in ring_buffer. Indices are wrapped with a bitmask when N is a power of two,
+/// otherwise with a compare against the constant N. Moving or swapping moves the elements one by one, so both are linear in size().
+/// @tparam T Type of the elements.
+/// @tparam N Capacity of the buffer.
+/// @tparam OverflowPolicy reject_overflow_policy (default) throws std::length_error when pushing to a full buffer, overwrite_overflow_policy replaces the element at the opposite end.
+template<typename T, size_t N, typename OverflowPolicy = reject_overflow_policy>
+class static_ring_buffer
+{
+    static_assert(std::is_same<OverflowPolicy, reject_overflow_policy>::value || std::is_same<OverflowPolicy, overwrite_overflow_policy>::value,
+        "static_ring_buffer can not grow, OverflowPolicy must be reject_overflow_policy or overwrite_overflow_policy.");
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using capacity_policy = std::conditional_t<(N & (N - 1)) == 0, pow2_capacity_policy, default_capacity_policy>;
+    using overflow_policy = OverflowPolicy;
+
+    using iterator = _indexed_iterator<static_ring_buffer, false>;
+    using const_iterator = _indexed_iterator<static_ring_buffer, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    using span = ring_buffer_span<value_type>;
+    using const_span = ring_buffer_span<const value_type>;
+
+    /// @brief Constructs an empty buffer.
+    /// @details Constant complexity.
+    static_ring_buffer() noexcept : m_size(0), m_tailIndex(0) {}
+
+    /// @brief Constructs a buffer with count copies of value.
+    /// @param count Amount of elements.
+    /// @param value Value to copy.
+    /// @throw Throws std::length_error if count > N. Can also throw from T's copy constructor.
+    /// @details Linear complexity in count.
+    static_ring_buffer(size_type count, const value_type& value) : static_ring_buffer()
+    {
+        _checkLength(count);
+        for (size_type i = 0; i < count; ++i)
+        {
+            _constructBack(value);
+        }
+    }
+
+    /// @brief Constructs a buffer with the elements of an initializer list.
+    /// @param init Elements to copy.
+    /// @throw Throws std::length_error if init has more than N elements. Can also throw from T's copy constructor.
+    /// @details Linear complexity in init.size().
+    static_ring_buffer(std::initializer_list<value_type> init) : static_ring_buffer()
+    {
+        _checkLength(init.size());
+        for (const auto& value : init)
+        {
+            _constructBack(value);
+        }
+    }
+
+    /// @brief Copy constructor. The copy starts at the first slot.
+    /// @details Linear complexity in other.size().
+    static_ring_buffer(const static_ring_buffer& other) : static_ring_buffer()
+    {
+        for (const auto& value : other)
+        {
+            _constructBack(value);
+        }
+    }
+
+    /// @brief Move constructor. Moves the elements one by one and leaves other empty.
+    /// @details Linear complexity in other.size().
+    static_ring_buffer(static_ring_buffer&& other) noexcept(std::is_nothrow_move_constructible<T>::value) : static_ring_buffer()
+    {
+        for (auto& value : other)
+        {
+            _constructBack(std::move(value));
+        }
+        other.clear();
+    }
+
+    /// @brief Copy assignment. Offers the basic exception guarantee.
+    /// @details Linear complexity in size() and other.size().
+    static_ring_buffer& operator=(const static_ring_buffer& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (const auto& value : other)
+            {
+                _constructBack(value);
+            }
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment. Moves the elements one by one and leaves other empty.
+    /// @details Linear complexity in size() and other.size().
+    static_ring_buffer& operator=(static_ring_buffer&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (auto& value : other)
+            {
+                _constructBack(std::move(value));
+            }
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~static_ring_buffer()
+    {
+        clear();
+    }
+
+    /// @brief Constructs a copy of value after the last element. If the buffer is full, the OverflowPolicy decides whether std::length_error is thrown or the first element is overwritten.
+    /// @param value Value to copy.
+    /// @throw Throws std::length_error if the buffer is full and rejects elements. Can also throw from T's copy constructor or copy assignment.
+    /// @details Constant complexity.
+    void push_back(const value_type& value)
+    {
+        _pushBack(value);
+    }
+
+    /// @brief Moves value after the last element. If the buffer is full, the OverflowPolicy decides whether std::length_error is thrown or the first element is overwritten.
+    /// @param value Value to move.
+    /// @details Constant complexity.
+    void push_back(value_type&& value)
+    {
+        _pushBack(std::move(value));
+    }
+
+    /// @brief Constructs a copy of value before the first element. If the buffer is full, the OverflowPolicy decides whether std::length_error is thrown or the last element is overwritten.
+    /// @param value Value to copy.
+    /// @throw Throws std::length_error if the buffer is full and rejects elements. Can also throw from T's copy constructor or copy assignment.
+    /// @details Constant complexity.
+    void push_front(const value_type& value)
+    {
+        _pushFront(value);
+    }
+
+    /// @brief Moves value before the first element. If the buffer is full, the OverflowPolicy decides whether std::length_error is thrown or the last element is overwritten.
+    /// @param value Value to move.
+    /// @details Constant complexity.
+    void push_front(value_type&& value)
+    {
+        _pushFront(std::move(value));
+    }
+
+    /// @brief Constructs an element in place after the last element. A full buffer is handled like in push_back.
+    /// @param args Arguments to construct value_type from.
+    /// @return Reference to the new element.
+    /// @details Constant complexity.
+    template<class... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (full())
+        {
+            _overflowBack(OverflowPolicy(), value_type(std::forward<Args>(args)...));
+        }
+        else
+        {
+            _constructBack(std::forward<Args>(args)...);
+        }
+        return back();
+    }
+
+    /// @brief Constructs an element in place before the first element. A full buffer is handled like in push_front.
+    /// @param args Arguments to construct value_type from.
+    /// @return Reference to the new element.
+    /// @details Constant complexity.
+    template<class... Args>
+    reference emplace_front(Args&&... args)
+    {
+        if (full())
+        {
+            _overflowFront(OverflowPolicy(), value_type(std::forward<Args>(args)...));
+        }
+        else
+        {
+            _constructFront(std::forward<Args>(args)...);
+        }
+        return front();
+    }
+
+    /// @brief Constructs a copy of value after the last element if the buffer is not full, regardless of the OverflowPolicy.
+    /// @param value Value to copy.
+    /// @return True if the element was added, false if the buffer is full.
+    /// @details Constant complexity.
+    bool try_push_back(const value_type& value)
+    {
+        if (full()) return false;
+        _constructBack(value);
+        return true;
+    }
+
+    /// @brief Moves value after the last element if the buffer is not full, regardless of the OverflowPolicy.
+    /// @param value Value to move. Left untouched if the buffer is full.
+    /// @return True if the element was added, false if the buffer is full.
+    /// @details Constant complexity.
+    bool try_push_back(value_type&& value)
+    {
+        if (full()) return false;
+        _constructBack(std::move(value));
+        return true;
+    }
+
+    /// @brief Removes the first element.
+    /// @pre The buffer is not empty.
+    /// @details Constant complexity.
+    void pop_front() noexcept
+    {
+        _slot(m_tailIndex)->~value_type();
+        m_tailIndex = capacity_policy::next(m_tailIndex, N);
+        --m_size;
+    }
+
+    /// @brief Removes the last element.
+    /// @pre The buffer is not empty.
+    /// @details Constant complexity.
+    void pop_back() noexcept
+    {
+        back().~value_type();
+        --m_size;
+    }
+
+    /// @brief Removes all elements.
+    /// @details Linear complexity in size(), constant for trivially destructible types.
+    void clear() noexcept
+    {
+        if (!std::is_trivially_destructible<T>::value)
+        {
+            for (auto& value : *this)
+            {
+                value.~value_type();
+            }
+        }
+        m_size = 0;
+        m_tailIndex = 0;
+    }
+
+    /// @brief Index operator.
+    /// @param logicalIndex Index of the element. Must be less than size().
+    /// @details Constant complexity.
+    reference operator[](size_type logicalIndex) noexcept
+    {
+        return *_slot(capacity_policy::wrap(m_tailIndex + logicalIndex, N));
+    }
+
+    /// @brief Index operator.
+    /// @param logicalIndex Index of the element. Must be less than size().
+    /// @details Constant complexity.
+    const_reference operator[](size_type logicalIndex) const noexcept
+    {
+        return *_slot(capacity_policy::wrap(m_tailIndex + logicalIndex, N));
+    }
+
+    /// @brief Gets an element with bounds checking.
+    /// @param logicalIndex Index of the element.
+    /// @throw Throws std::out_of_range if logicalIndex >= size().
+    /// @details Constant complexity.
+    reference at(size_type logicalIndex)
+    {
+        if (logicalIndex >= size())
+        {
+            throw std::out_of_range("Index is out of range");
+        }
+        return (*this)[logicalIndex];
+    }
+
+    /// @brief Gets an element with bounds checking.
+    /// @param logicalIndex Index of the element.
+    /// @throw Throws std::out_of_range if logicalIndex >= size().
+    /// @details Constant complexity.
+    const_reference at(size_type logicalIndex) const
+    {
+        if (logicalIndex >= size())
+        {
+            throw std::out_of_range("Index is out of range");
+        }
+        return (*this)[logicalIndex];
+    }
+
+    /// @brief Returns a reference to the first element. Behaviour is undefined for empty buffer.
+    /// @details Constant complexity.
+    reference front() noexcept { return *_slot(m_tailIndex); }
+
+    /// @brief Returns a reference to the first element. Behaviour is undefined for empty buffer.
+    /// @details Constant complexity.
+    const_reference front() const noexcept { return *_slot(m_tailIndex); }
+
+    /// @brief Returns a reference to the last element. Behaviour is undefined for empty buffer.
+    /// @details Constant complexity.
+    reference back() noexcept { return (*this)[m_size - 1]; }
+
+    /// @brief Returns a reference to the last element. Behaviour is undefined for empty buffer.
+    /// @details Constant complexity.
+    const_reference back() const noexcept { return (*this)[m_size - 1]; }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return iterator(this, size()); }
+    const_iterator end() const noexcept { return const_iterator(this, size()); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /// @brief Gets the elements as contiguous memory segments.
+    /// @return Pair of segments in logical order. The second segment is empty unless the elements wrap around the end of the storage.
+    /// @details Constant complexity.
+    std::pair<span, span> segments() noexcept
+    {
+        const auto firstCount = std::min(m_size, N - m_tailIndex);
+        return {span(_slot(m_tailIndex), firstCount), span(_slot(0), m_size - firstCount)};
+    }
+
+    /// @brief Gets the elements as contiguous read-only memory segments.
+    /// @return Pair of segments in logical order. The second segment is empty unless the elements wrap around the end of the storage.
+    /// @details Constant complexity.
+    std::pair<const_span, const_span> segments() const noexcept
+    {
+        auto segs = const_cast<static_ring_buffer*>(this)->segments();
+        return {const_span(segs.first.data(), segs.first.size()), const_span(segs.second.data(), segs.second.size())};
+    }
+
+    /// @brief Gets the size of the buffer.
+    /// @details Constant complexity.
+    size_type size() const noexcept { return m_size; }
+
+    /// @brief Gets the capacity, which is N.
+    /// @details Constant complexity.
+    static constexpr size_type capacity() noexcept { return N; }
+
+    /// @brief Gets the maximum size, which is N.
+    /// @details Constant complexity.
+    static constexpr size_type max_size() noexcept { return N; }
+
+    /// @brief Check if buffer is empty.
+    /// @details Constant complexity.
+    bool empty() const noexcept { return m_size == 0; }
+
+    /// @brief Check if every slot holds an element. Pushing to a full buffer is handled by the OverflowPolicy.
+    /// @details Constant complexity.
+    bool full() const noexcept { return m_size == N; }
+
+    /// @brief Swaps the elements of two buffers through a temporary buffer.
+    /// @details Linear complexity in size() and other.size().
+    void swap(static_ring_buffer& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        static_ring_buffer temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    /// @brief Friend swap.
+    /// @details Linear complexity in a.size() and b.size().
+    friend void swap(static_ring_buffer& a, static_ring_buffer& b) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        a.swap(b);
+    }
+
+private:
+
+    using storage_type = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    pointer _slot(size_type index) noexcept
+    {
+        return reinterpret_cast<pointer>(&m_storage[index]);
+    }
+
+    const_pointer _slot(size_type index) const noexcept
+    {
+        return reinterpret_cast<const_pointer>(&m_storage[index]);
+    }
+
+    size_type _headIndex() const noexcept
+    {
+        return capacity_policy::wrap(m_tailIndex + m_size, N);
+    }
+
+    static void _checkLength(size_type count)
+    {
+        if (count > N)
+        {
+            throw std::length_error("static_ring_buffer capacity exceeded");
+        }
+    }
+
+    template<class... Args>
+    void _constructBack(Args&&... args)
+    {
+        ::new (static_cast<void*>(_slot(_headIndex()))) value_type(std::forward<Args>(args)...);
+        ++m_size;
+    }
+
+    template<class... Args>
+    void _constructFront(Args&&... args)
+    {
+        const auto newIndex = capacity_policy::prev(m_tailIndex, N);
+        ::new (static_cast<void*>(_slot(newIndex))) value_type(std::forward<Args>(args)...);
+        m_tailIndex = newIndex;
+        ++m_size;
+    }
+
+    template<typename U>
+    void _pushBack(U&& value)
+    {
+        if (full())
+        {
+            _overflowBack(OverflowPolicy(), std::forward<U>(value));
+            return;
+        }
+        _constructBack(std::forward<U>(value));
+    }
+
+    template<typename U>
+    void _pushFront(U&& value)
+    {
+        if (full())
+        {
+            _overflowFront(OverflowPolicy(), std::forward<U>(value));
+            return;
+        }
+        _constructFront(std::forward<U>(value));
+    }
+
+    template<typename U>
+    void _overflowBack(reject_overflow_policy, U&&)
+    {
+        throw std::length_error("static_ring_buffer is full");
+    }
+
+    template<typename U>
+    void _overflowFront(reject_overflow_policy, U&&)
+    {
+        throw std::length_error("static_ring_buffer is full");
+    }
+
+    // The slot of the first element is the slot after the last element, so its element is assigned to and becomes the last element.
+    template<typename U>
+    void _overflowBack(overwrite_overflow_policy, U&& value)
+    {
+        if (N == 0) return;
+
+        *_slot(m_tailIndex) = std::forward<U>(value);
+        m_tailIndex = capacity_policy::next(m_tailIndex, N);
+    }
+
+    template<typename U>
+    void _overflowFront(overwrite_overflow_policy, U&& value)
+    {
+        if (N == 0) return;
+
+        const auto newIndex = capacity_policy::prev(m_tailIndex, N);
+        *_slot(newIndex) = std::forward<U>(value);
+        m_tailIndex = newIndex;
+    }
+
+    storage_type m_storage[N == 0 ? 1 : N];  /*!< Inline storage for N elements. Only the slots of the elements hold live objects.*/
+
+    size_type m_size;  /*!< Amount of elements in the buffer.*/
+
+    size_type m_tailIndex;  /*!< Index of the first element.*/
+};
+
+/// @brief Equality comparator. Compares buffers element-to-element.
+/// @param lhs Left hand side operand.
+/// @param rhs Right hand side operand.
+/// @return True if the buffers have the same size and their elements compare equal.
+template<typename T, size_t N, typename Overflow>
+inline bool operator==(const static_ring_buffer<T,N,Overflow>& lhs, const static_ring_buffer<T,N,Overflow>& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+/// @brief Not-equal comparator. Compares buffers element-to-element.
+/// @param lhs Left hand side operand.
+/// @param rhs Right hand side operand.
+/// @return True if any of the elements are not equal.
+template<typename T, size_t N, typename Overflow>
+inline bool operator!=(const static_ring_buffer<T,N,Overflow>& lhs, const static_ring_buffer<T,N,Overflow>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+#endif /*DYNAMIC_RINGBUFFER_HPP*/
@@ -0,0 +1,14 @@
+#include "ring_buffer.hpp"
+#include <array>
+#include <memory>
+
+// The buffers are allocated on the heap so that massif sees the inline storage too.
+int main()
+{
+auto buffers = std::make_unique<std::array<static_ring_buffer<int, 64>, 1000>>();
+
+    for(auto& v : *buffers)
+    {
+        v = static_ring_buffer<int, 64>(64, 1);
+    }
+}
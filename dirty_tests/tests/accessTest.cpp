@@ -23,6 +23,21 @@ void BM_IndexAccess(benchmark::State& state) {
     }
 }
 
+template <typename Container>
+void BM_IndexScan(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+
+    Container container(size);
+
+    for (auto _ : state) {
+        long long sum = 0;
+        for (size_t i = 0; i < container.size(); ++i) {
+            sum += container[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
 template <typename Container>
 void RegisterBenchmark(const std::string& name) {
 
@@ -32,12 +47,27 @@ void RegisterBenchmark(const std::string& name) {
         ->Unit(benchmark::kNanosecond);
 }
 
+template <typename Container>
+void RegisterScanBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_IndexScan<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
 int main(int argc, char** argv)
 {
     RegisterBenchmark<std::vector<long long>>("BM_Vector_IndexAccess");
     RegisterBenchmark<std::deque<long long>>("BM_Deque_IndexAccess");
     //RegisterBenchmark<std::list<long long>>("BM_List_InsertAtBegin");
     RegisterBenchmark<ring_buffer<long long>>("BM_RingBuffer_IndexAccess");
+    RegisterBenchmark<pow2_ring_buffer<long long>>("BM_Pow2RingBuffer_IndexAccess");
+
+    RegisterScanBenchmark<std::vector<long long>>("BM_Vector_IndexScan");
+    RegisterScanBenchmark<std::deque<long long>>("BM_Deque_IndexScan");
+    RegisterScanBenchmark<ring_buffer<long long>>("BM_RingBuffer_IndexScan");
+    RegisterScanBenchmark<pow2_ring_buffer<long long>>("BM_Pow2RingBuffer_IndexScan");
 
     benchmark::Initialize(&argc, argv);
     benchmark::RunSpecifiedBenchmarks();
@@ -0,0 +1,55 @@
+#include "ring_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <deque>
+#include <memory>
+
+// Copies a batch from a std::vector into a new buffer and back out again, as done without adopt() and release().
+template <typename Container>
+void BM_CopyRoundTrip(benchmark::State& state) {
+    std::vector<long long> batch(state.range(0), 42);
+
+    for (auto _ : state) {
+        Container container(batch.begin(), batch.end());
+        batch.assign(container.begin(), container.end());
+        benchmark::DoNotOptimize(batch.data());
+    }
+}
+
+// Hands the same memory block to a buffer and takes it back. Neither direction moves elements, so the time does not depend on the size.
+void BM_AdoptRelease(benchmark::State& state) {
+    using buffer = ring_buffer<long long>;
+
+    const auto size = static_cast<size_t>(state.range(0));
+    std::allocator<long long> allocator;
+    buffer::raw_storage storage{allocator.allocate(size), size, size};
+    std::uninitialized_fill_n(storage.data, size, 42);
+
+    buffer container;
+    for (auto _ : state) {
+        container.adopt(storage);
+        storage = container.release();
+        benchmark::DoNotOptimize(storage.data);
+    }
+
+    allocator.deallocate(storage.data, storage.capacity);
+}
+
+void RegisterAdoptBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(10)
+        ->Range(1000, 1000000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+int main(int argc, char** argv) {
+    RegisterAdoptBenchmark("BM_Deque_CopyRoundTrip", BM_CopyRoundTrip<std::deque<long long>>);
+    RegisterAdoptBenchmark("BM_RingBuffer_CopyRoundTrip", BM_CopyRoundTrip<ring_buffer<long long>>);
+    RegisterAdoptBenchmark("BM_RingBuffer_AdoptRelease", BM_AdoptRelease);
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+
+#include "ring_buffer.hpp"
+#include "wrapFixture.hpp"
+#include <vector>
+#include <deque>
+
+template <typename Container>
+void BM_stdCount(benchmark::State& state) {
+    Container container(state.range(0));
+    makeWrapped(container);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::count(container.begin(), container.end(), 2));
+    }
+}
+
+template <typename Container>
+void BM_segmentCount(benchmark::State& state) {
+    Container container(state.range(0));
+    makeWrapped(container);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rbuf::count(container.begin(), container.end(), 2));
+    }
+}
+
+template <typename Container>
+void BM_stdAccumulate(benchmark::State& state) {
+    Container container(state.range(0));
+    makeWrapped(container);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(container.begin(), container.end(), 0LL));
+    }
+}
+
+template <typename Container>
+void BM_segmentAccumulate(benchmark::State& state) {
+    Container container(state.range(0));
+    makeWrapped(container);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rbuf::accumulate(container.begin(), container.end(), 0LL));
+    }
+}
+
+template <typename Container>
+void BM_stdFill(benchmark::State& state) {
+    Container container(state.range(0));
+    makeWrapped(container);
+
+    for (auto _ : state) {
+        std::fill(container.begin(), container.end(), 7);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename Container>
+void BM_segmentFill(benchmark::State& state) {
+    Container container(state.range(0));
+    makeWrapped(container);
+
+    for (auto _ : state) {
+        rbuf::fill(container.begin(), container.end(), 7);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename Container>
+void BM_stdCopy(benchmark::State& state) {
+    Container container(state.range(0));
+    makeWrapped(container);
+    std::vector<long long> target(container.size());
+
+    for (auto _ : state) {
+        std::copy(container.begin(), container.end(), target.begin());
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename Container>
+void BM_segmentCopy(benchmark::State& state) {
+    Container container(state.range(0));
+    makeWrapped(container);
+    std::vector<long long> target(container.size());
+
+    for (auto _ : state) {
+        rbuf::copy(container.begin(), container.end(), target.begin());
+        benchmark::ClobberMemory();
+    }
+}
+
+void RegisterAlgorithmBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+int main(int argc, char** argv)
+{
+    RegisterAlgorithmBenchmark("BM_Vector_Count", BM_stdCount<std::vector<long long>>);
+    RegisterAlgorithmBenchmark("BM_Deque_Count", BM_stdCount<std::deque<long long>>);
+    RegisterAlgorithmBenchmark("BM_RingBuffer_Count", BM_stdCount<ring_buffer<long long>>);
+    RegisterAlgorithmBenchmark("BM_RingBuffer_SegmentCount", BM_segmentCount<ring_buffer<long long>>);
+
+    RegisterAlgorithmBenchmark("BM_Vector_Accumulate", BM_stdAccumulate<std::vector<long long>>);
+    RegisterAlgorithmBenchmark("BM_Deque_Accumulate", BM_stdAccumulate<std::deque<long long>>);
+    RegisterAlgorithmBenchmark("BM_RingBuffer_Accumulate", BM_stdAccumulate<ring_buffer<long long>>);
+    RegisterAlgorithmBenchmark("BM_RingBuffer_SegmentAccumulate", BM_segmentAccumulate<ring_buffer<long long>>);
+
+    RegisterAlgorithmBenchmark("BM_Vector_Fill", BM_stdFill<std::vector<long long>>);
+    RegisterAlgorithmBenchmark("BM_Deque_Fill", BM_stdFill<std::deque<long long>>);
+    RegisterAlgorithmBenchmark("BM_RingBuffer_Fill", BM_stdFill<ring_buffer<long long>>);
+    RegisterAlgorithmBenchmark("BM_RingBuffer_SegmentFill", BM_segmentFill<ring_buffer<long long>>);
+
+    RegisterAlgorithmBenchmark("BM_Vector_Copy", BM_stdCopy<std::vector<long long>>);
+    RegisterAlgorithmBenchmark("BM_Deque_Copy", BM_stdCopy<std::deque<long long>>);
+    RegisterAlgorithmBenchmark("BM_RingBuffer_Copy", BM_stdCopy<ring_buffer<long long>>);
+    RegisterAlgorithmBenchmark("BM_RingBuffer_SegmentCopy", BM_segmentCopy<ring_buffer<long long>>);
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,63 @@
+#include "ring_buffer.hpp"
+#include "wrapFixture.hpp"
+#include <benchmark/benchmark.h>
+
+// Scales every element in place, one contiguous segment at a time.
+template <typename Container>
+void BM_SegmentScale(benchmark::State& state) {
+    Container container(state.range(0), 1.0f);
+    // Wraps after two thirds of the elements, at an offset that is not a multiple of a vector.
+    rotateToBack(container, container.size() / 3);
+
+    for (auto _ : state) {
+        const auto segs = container.segments();
+        for (auto& value : segs.first) {
+            value = value * 0.5f + 1.0f;
+        }
+        for (auto& value : segs.second) {
+            value = value * 0.5f + 1.0f;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+}
+
+// Counts the elements above a threshold, one contiguous segment at a time.
+template <typename Container>
+void BM_SegmentCountAbove(benchmark::State& state) {
+    Container container(state.range(0), 1.0f);
+    rotateToBack(container, container.size() / 3);
+
+    for (auto _ : state) {
+        const auto segs = container.segments();
+        int count = 0;
+        for (auto value : segs.first) {
+            count += value > 1.5f;
+        }
+        for (auto value : segs.second) {
+            count += value > 1.5f;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+}
+
+void RegisterScanBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+int main(int argc, char** argv) {
+    RegisterScanBenchmark("BM_RingBuffer_SegmentScale", BM_SegmentScale<ring_buffer<float>>);
+    RegisterScanBenchmark("BM_AlignedRingBuffer_SegmentScale", BM_SegmentScale<aligned_ring_buffer<float, 64>>);
+    RegisterScanBenchmark("BM_RingBuffer_SegmentCountAbove", BM_SegmentCountAbove<ring_buffer<float>>);
+    RegisterScanBenchmark("BM_AlignedRingBuffer_SegmentCountAbove", BM_SegmentCountAbove<aligned_ring_buffer<float, 64>>);
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
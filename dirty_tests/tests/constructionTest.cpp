@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include "ring_buffer.hpp"
+#include "wrapFixture.hpp"
 #include <vector>
 #include <deque>
 #include <list>
@@ -13,6 +14,37 @@ void BM_construction(benchmark::State& state) {
     }
 }
 
+// Copies a container whose elements wrap around the end of the ring buffer's memory.
+template <typename Container>
+void BM_copyConstruction(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+    Container source(size);
+    makeWrapped(source);
+
+    for (auto _ : state) {
+        Container container(source);
+        benchmark::DoNotOptimize(container);
+    }
+}
+
+// Leaves trivially default constructible elements uninitialized.
+template <typename Container>
+void BM_defaultInitConstruction(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        Container container(size, default_init);
+        benchmark::DoNotOptimize(container);
+    }
+}
+
+void RegisterConstructionBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
 template <typename Container>
 void RegisterBenchmark(const std::string& name) {
 
@@ -27,7 +59,12 @@ int main(int argc, char** argv)
     RegisterBenchmark<std::vector<long long>>("BM_Vector_Construction");
     RegisterBenchmark<std::deque<long long>>("BM_Deque_Construction");
     RegisterBenchmark<std::list<long long>>("BM_List_Construction");
-    RegisterBenchmark<ring_buffer<long long>>("BM_RingBuffer_IndexAccess");
+    RegisterBenchmark<ring_buffer<long long>>("BM_RingBuffer_Construction");
+    RegisterConstructionBenchmark("BM_RingBuffer_DefaultInitConstruction", BM_defaultInitConstruction<ring_buffer<long long>>);
+
+    RegisterConstructionBenchmark("BM_Vector_CopyConstruction", BM_copyConstruction<std::vector<long long>>);
+    RegisterConstructionBenchmark("BM_Deque_CopyConstruction", BM_copyConstruction<std::deque<long long>>);
+    RegisterConstructionBenchmark("BM_RingBuffer_CopyConstruction", BM_copyConstruction<ring_buffer<long long>>);
 
     benchmark::Initialize(&argc, argv);
     benchmark::RunSpecifiedBenchmarks();
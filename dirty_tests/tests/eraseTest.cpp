@@ -0,0 +1,95 @@
+#include "ring_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <deque>
+
+// Erases one element at Percent of the size and pushes a new element to the back, so that the size stays constant.
+template <typename Container, int Percent>
+void BM_Erase(benchmark::State& state) {
+    const long long test_value = 652;
+
+    Container container(state.range(0));
+    const auto offset = container.size() * Percent / 100;
+
+    for (auto _ : state) {
+        container.erase(container.begin() + offset);
+        container.push_back(test_value);
+    }
+}
+
+// Erases the first and last elements until the container is empty.
+template <typename Container>
+void BM_EraseEnds(benchmark::State& state) {
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Container container(size);
+        state.ResumeTiming();
+
+        while (!container.empty()) {
+            container.erase(container.begin());
+            if (!container.empty()) {
+                container.erase(container.end() - 1);
+            }
+        }
+    }
+}
+
+// Erases a range of a tenth of the elements at Percent of the size.
+template <typename Container, int Percent>
+void BM_EraseRange(benchmark::State& state) {
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Container container(size);
+        const auto offset = size * Percent / 100;
+        state.ResumeTiming();
+
+        container.erase(container.begin() + offset, container.begin() + offset + size / 10);
+    }
+}
+
+void RegisterEraseBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+int main(int argc, char** argv) {
+    RegisterEraseBenchmark("BM_Vector_EraseFront", BM_Erase<std::vector<long long>, 0>);
+    RegisterEraseBenchmark("BM_Deque_EraseFront", BM_Erase<std::deque<long long>, 0>);
+    RegisterEraseBenchmark("BM_RingBuffer_EraseFront", BM_Erase<ring_buffer<long long>, 0>);
+
+    RegisterEraseBenchmark("BM_Vector_EraseNearFront", BM_Erase<std::vector<long long>, 10>);
+    RegisterEraseBenchmark("BM_Deque_EraseNearFront", BM_Erase<std::deque<long long>, 10>);
+    RegisterEraseBenchmark("BM_RingBuffer_EraseNearFront", BM_Erase<ring_buffer<long long>, 10>);
+
+    RegisterEraseBenchmark("BM_Vector_EraseMiddle", BM_Erase<std::vector<long long>, 50>);
+    RegisterEraseBenchmark("BM_Deque_EraseMiddle", BM_Erase<std::deque<long long>, 50>);
+    RegisterEraseBenchmark("BM_RingBuffer_EraseMiddle", BM_Erase<ring_buffer<long long>, 50>);
+
+    RegisterEraseBenchmark("BM_Vector_EraseNearBack", BM_Erase<std::vector<long long>, 90>);
+    RegisterEraseBenchmark("BM_Deque_EraseNearBack", BM_Erase<std::deque<long long>, 90>);
+    RegisterEraseBenchmark("BM_RingBuffer_EraseNearBack", BM_Erase<ring_buffer<long long>, 90>);
+
+    RegisterEraseBenchmark("BM_Vector_EraseEnds", BM_EraseEnds<std::vector<long long>>);
+    RegisterEraseBenchmark("BM_Deque_EraseEnds", BM_EraseEnds<std::deque<long long>>);
+    RegisterEraseBenchmark("BM_RingBuffer_EraseEnds", BM_EraseEnds<ring_buffer<long long>>);
+
+    RegisterEraseBenchmark("BM_Vector_EraseRangeFront", BM_EraseRange<std::vector<long long>, 0>);
+    RegisterEraseBenchmark("BM_Deque_EraseRangeFront", BM_EraseRange<std::deque<long long>, 0>);
+    RegisterEraseBenchmark("BM_RingBuffer_EraseRangeFront", BM_EraseRange<ring_buffer<long long>, 0>);
+
+    RegisterEraseBenchmark("BM_Vector_EraseRangeMiddle", BM_EraseRange<std::vector<long long>, 45>);
+    RegisterEraseBenchmark("BM_Deque_EraseRangeMiddle", BM_EraseRange<std::deque<long long>, 45>);
+    RegisterEraseBenchmark("BM_RingBuffer_EraseRangeMiddle", BM_EraseRange<ring_buffer<long long>, 45>);
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
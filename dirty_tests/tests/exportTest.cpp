@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include "ring_buffer.hpp"
+#include "wrapFixture.hpp"
+#include <vector>
+#include <string>
+#include <cstring>
+
+template <typename Container>
+void BM_ExportIterator(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+
+    Container container(size);
+    makeWrapped(container);
+    std::vector<long long> target(size);
+
+    for (auto _ : state) {
+        std::copy(container.begin(), container.end(), target.begin());
+        benchmark::DoNotOptimize(target.data());
+    }
+}
+
+void BM_ExportVectorData(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+
+    std::vector<long long> container(size);
+    std::vector<long long> target(size);
+
+    for (auto _ : state) {
+        std::memcpy(target.data(), container.data(), container.size() * sizeof(long long));
+        benchmark::DoNotOptimize(target.data());
+    }
+}
+
+// data() linearizes the buffer before the copy.
+void BM_ExportRingBufferData(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+
+    std::vector<long long> target(size);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        ring_buffer<long long> container(size);
+        makeWrapped(container);
+        state.ResumeTiming();
+
+        std::memcpy(target.data(), container.data(), container.size() * sizeof(long long));
+        benchmark::DoNotOptimize(target.data());
+    }
+}
+
+// Linearizes a wrapped buffer with SparePercent of its size as free slots. Without free slots the elements are rotated, otherwise moved once.
+template <typename T, int SparePercent>
+void BM_Linearize(benchmark::State& state) {
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        ring_buffer<T> container;
+        container.reserve(size + size * SparePercent / 100);
+        container.resize(size);
+        makeWrapped(container);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(container.data());
+    }
+}
+
+void BM_ExportRingBufferSegments(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+
+    ring_buffer<long long> container(size);
+    makeWrapped(container);
+    std::vector<long long> target(size);
+
+    for (auto _ : state) {
+        auto segments = container.segments();
+        std::memcpy(target.data(), segments.first.data(), segments.first.size() * sizeof(long long));
+        std::memcpy(target.data() + segments.first.size(), segments.second.data(), segments.second.size() * sizeof(long long));
+        benchmark::DoNotOptimize(target.data());
+    }
+}
+
+template <typename Container>
+void RegisterIteratorBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_ExportIterator<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+void RegisterExportBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+int main(int argc, char** argv)
+{
+    RegisterIteratorBenchmark<std::vector<long long>>("BM_Vector_ExportIterator");
+    RegisterIteratorBenchmark<ring_buffer<long long>>("BM_RingBuffer_ExportIterator");
+
+    RegisterExportBenchmark("BM_Vector_ExportData", BM_ExportVectorData);
+    RegisterExportBenchmark("BM_RingBuffer_ExportData", BM_ExportRingBufferData);
+    RegisterExportBenchmark("BM_RingBuffer_ExportSegments", BM_ExportRingBufferSegments);
+
+    RegisterExportBenchmark("BM_RingBuffer_LinearizeFull", BM_Linearize<long long, 0>);
+    RegisterExportBenchmark("BM_RingBuffer_LinearizeSpare", BM_Linearize<long long, 25>);
+    RegisterExportBenchmark("BM_RingBuffer_LinearizeFullString", BM_Linearize<std::string, 0>);
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+}
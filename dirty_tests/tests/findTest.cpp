@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include "ring_buffer.hpp"
+#include "wrapFixture.hpp"
 #include <vector>
 #include <deque>
 #include <list>
@@ -15,7 +16,7 @@ void BM_findlist(benchmark::State& state) {
     container.insert(it, static_cast<long long>(2));
 
     for (auto _ : state) {
-        std::find(container.begin(), container.end(), static_cast<long long> (2));
+        benchmark::DoNotOptimize(std::find(container.begin(), container.end(), static_cast<long long> (2)));
     }
 }
 
@@ -27,7 +28,67 @@ void BM_find(benchmark::State& state) {
     container.insert(container.begin() + container.size() / 2, static_cast<long long>(2));
 
     for (auto _ : state) {
-        std::find(container.begin(), container.end(), static_cast<long long> (2));
+        benchmark::DoNotOptimize(std::find(container.begin(), container.end(), static_cast<long long> (2)));
+    }
+}
+
+// rbuf::find splits ring_buffer ranges into contiguous segments, other containers are forwarded to std::find.
+template <typename Container>
+void BM_segmentFind(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+    
+    Container container(size);
+    container.insert(container.begin() + container.size() / 2, static_cast<long long>(2));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rbuf::find(container.begin(), container.end(), static_cast<long long> (2)));
+    }
+}
+
+// Searches a container whose elements wrap around the end of its memory.
+template <typename Container>
+void BM_findWrapped(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+
+    Container container(size);
+    makeWrapped(container);
+    // Assigned in place, as inserting into the full buffer would reallocate it and undo the wrap.
+    container[size / 2] = 2;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(container.begin(), container.end(), static_cast<long long> (2)));
+    }
+}
+
+// Same wrapped container as BM_findWrapped, searched with rbuf::find one contiguous segment at a time.
+template <typename Container>
+void BM_segmentFindWrapped(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+
+    Container container(size);
+    makeWrapped(container);
+    // Assigned in place, as inserting into the full buffer would reallocate it and undo the wrap.
+    container[size / 2] = 2;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rbuf::find(container.begin(), container.end(), static_cast<long long> (2)));
+    }
+}
+
+// Sums a wrapped container through operator[].
+template <typename Container>
+void BM_indexScanWrapped(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+
+    Container container(size);
+    makeWrapped(container);
+
+    for (auto _ : state) {
+        long long sum = 0;
+        for (size_t i = 0; i < container.size(); ++i) {
+            sum += container[i];
+        }
+        benchmark::DoNotOptimize(sum);
     }
 }
 
@@ -40,11 +101,68 @@ void RegisterBenchmark(const std::string& name) {
         ->Unit(benchmark::kNanosecond);
 }
 
+template <typename Container>
+void RegisterWrappedBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_findWrapped<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+template <typename Container>
+void RegisterSegmentBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_segmentFind<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+template <typename Container>
+void RegisterWrappedSegmentBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_segmentFindWrapped<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+template <typename Container>
+void RegisterIndexScanBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_indexScanWrapped<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
 int main(int argc, char** argv)
 {
     RegisterBenchmark<std::vector<long long>>("BM_Vector_find");
     RegisterBenchmark<std::deque<long long>>("BM_Deque_find");
     RegisterBenchmark<ring_buffer<long long>>("BM_RingBuffer_find");
+    RegisterBenchmark<pow2_ring_buffer<long long>>("BM_Pow2RingBuffer_find");
+    RegisterBenchmark<mirrored_ring_buffer<long long>>("BM_MirroredRingBuffer_find");
+
+    RegisterSegmentBenchmark<std::vector<long long>>("BM_Vector_segmentFind");
+    RegisterSegmentBenchmark<ring_buffer<long long>>("BM_RingBuffer_segmentFind");
+
+    // The mirrored rows show what mirrored_allocator saves on a wrapped buffer: operator[] without wrapping, and one segment instead of two.
+    // Iterators still wrap at the physical boundary, so findWrapped is not expected to differ.
+    RegisterWrappedBenchmark<std::deque<long long>>("BM_Deque_findWrapped");
+    RegisterWrappedBenchmark<ring_buffer<long long>>("BM_RingBuffer_findWrapped");
+    RegisterWrappedBenchmark<pow2_ring_buffer<long long>>("BM_Pow2RingBuffer_findWrapped");
+    RegisterWrappedBenchmark<mirrored_ring_buffer<long long>>("BM_MirroredRingBuffer_findWrapped");
+
+    RegisterWrappedSegmentBenchmark<ring_buffer<long long>>("BM_RingBuffer_segmentFindWrapped");
+    RegisterWrappedSegmentBenchmark<pow2_ring_buffer<long long>>("BM_Pow2RingBuffer_segmentFindWrapped");
+    RegisterWrappedSegmentBenchmark<mirrored_ring_buffer<long long>>("BM_MirroredRingBuffer_segmentFindWrapped");
+
+    RegisterIndexScanBenchmark<std::deque<long long>>("BM_Deque_indexScanWrapped");
+    RegisterIndexScanBenchmark<ring_buffer<long long>>("BM_RingBuffer_indexScanWrapped");
+    RegisterIndexScanBenchmark<pow2_ring_buffer<long long>>("BM_Pow2RingBuffer_indexScanWrapped");
+    RegisterIndexScanBenchmark<mirrored_ring_buffer<long long>>("BM_MirroredRingBuffer_indexScanWrapped");
 
     benchmark::RegisterBenchmark("BM_List_InsertAtBegin",BM_findlist)
         ->RangeMultiplier(2)
@@ -0,0 +1,72 @@
+#include "ring_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+size_t liveBytes = 0;
+size_t peakBytes = 0;
+
+// Allocator that keeps track of the peak amount of allocated memory.
+template <typename T>
+struct peak_allocator
+{
+    using value_type = T;
+
+    peak_allocator() = default;
+
+    template <typename U>
+    peak_allocator(const peak_allocator<U>&) {}
+
+    T* allocate(size_t n)
+    {
+        liveBytes += n * sizeof(T);
+        peakBytes = std::max(peakBytes, liveBytes);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n)
+    {
+        liveBytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    bool operator==(const peak_allocator&) const { return true; }
+    bool operator!=(const peak_allocator&) const { return false; }
+};
+
+template <typename Container>
+static void BM_natural_growth(benchmark::State& state)
+{
+    size_t peak = 0;
+
+    for(auto _ : state)
+    {
+        {
+            peakBytes = liveBytes;
+            Container buf;
+            for(auto i = 0 ; i < state.range(0) ; i++)
+            {
+                buf.push_back(1);
+            }
+            benchmark::DoNotOptimize(buf.size());
+            peak = peakBytes;
+        }
+    }
+
+    // Peak memory used while growing to state.range(0) elements, relative to the memory of the elements.
+    state.counters["peak_bytes"] = peak;
+    state.counters["overhead"] = static_cast<double>(peak) / (state.range(0) * sizeof(int));
+}
+
+using default_buffer = ring_buffer<int, peak_allocator<int>>;
+using double_buffer = ring_buffer<int, peak_allocator<int>, default_capacity_policy, double_growth_policy>;
+using pow2_buffer = ring_buffer<int, peak_allocator<int>, pow2_capacity_policy, pow2_growth_policy>;
+using page_buffer = ring_buffer<int, peak_allocator<int>, default_capacity_policy, page_growth_policy<>>;
+using vector = std::vector<int, peak_allocator<int>>;
+
+BENCHMARK_TEMPLATE(BM_natural_growth, default_buffer)->Range(1 << 10, 1 << 19);
+BENCHMARK_TEMPLATE(BM_natural_growth, double_buffer)->Range(1 << 10, 1 << 19);
+BENCHMARK_TEMPLATE(BM_natural_growth, pow2_buffer)->Range(1 << 10, 1 << 19);
+BENCHMARK_TEMPLATE(BM_natural_growth, page_buffer)->Range(1 << 10, 1 << 19);
+BENCHMARK_TEMPLATE(BM_natural_growth, vector)->Range(1 << 10, 1 << 19);
+
+BENCHMARK_MAIN();
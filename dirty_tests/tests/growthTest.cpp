@@ -0,0 +1,178 @@
+#include "ring_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <deque>
+#include <string>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <limits>
+
+template <typename T>
+T makeValue(long long i);
+
+template <>
+long long makeValue<long long>(long long i) {
+    return i;
+}
+
+// Long enough to not fit in the small string buffer, so that copying a string allocates.
+template <>
+std::string makeValue<std::string>(long long i) {
+    return "string-that-does-not-fit-the-small-buffer-" + std::to_string(i);
+}
+
+template <>
+std::unique_ptr<long long> makeValue<std::unique_ptr<long long>>(long long i) {
+    return std::unique_ptr<long long>(new long long(i));
+}
+
+// Grows an empty container to state.range(0) elements, so that every reallocation relocates the existing elements.
+template <typename Container>
+void BM_Growth(benchmark::State& state) {
+    using T = typename Container::value_type;
+
+    const auto size = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<T> values;
+        values.reserve(size);
+        for (long long i = 0; i < size; i++) {
+            values.push_back(makeValue<T>(i));
+        }
+        Container container;
+        state.ResumeTiming();
+
+        for (auto& value : values) {
+            container.push_back(std::move(value));
+        }
+        benchmark::DoNotOptimize(container.size());
+
+        state.PauseTiming();
+        container = Container();
+        state.ResumeTiming();
+    }
+}
+
+// Grows the container with push_front, which wraps the elements around the end of the memory before each reallocation.
+template <typename Container>
+void BM_GrowthFront(benchmark::State& state) {
+    using T = typename Container::value_type;
+
+    const auto size = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<T> values;
+        values.reserve(size);
+        for (long long i = 0; i < size; i++) {
+            values.push_back(makeValue<T>(i));
+        }
+        Container container;
+        state.ResumeTiming();
+
+        for (auto& value : values) {
+            container.push_front(std::move(value));
+        }
+        benchmark::DoNotOptimize(container.size());
+
+        state.PauseTiming();
+        container = Container();
+        state.ResumeTiming();
+    }
+}
+
+using incremental_ring_buffer = ring_buffer<long long, std::allocator<long long>, default_capacity_policy, default_growth_policy, incremental_overflow_policy<>>;
+
+// Times every push while growing an empty container to state.range(0) elements. The slowest push and the 99.9th percentile are reported as counters,
+// since a push that reallocates relocates the whole container at once unless the growth is incremental. The lowest value over the iterations is kept,
+// as a relocation recurs in every iteration while preemption by the scheduler does not.
+template <typename Container>
+void BM_PushLatency(benchmark::State& state) {
+    using clock = std::chrono::steady_clock;
+
+    const auto size = state.range(0);
+    std::vector<long long> latencies(size);
+    double worst = std::numeric_limits<double>::max();
+    double percentile = std::numeric_limits<double>::max();
+
+    for (auto _ : state) {
+        Container container;
+
+        for (long long i = 0; i < size; i++) {
+            const auto start = clock::now();
+            container.push_back(i);
+            latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+        }
+        benchmark::DoNotOptimize(container.size());
+
+        state.PauseTiming();
+        auto nth = latencies.begin() + size * 999 / 1000;
+        std::nth_element(latencies.begin(), nth, latencies.end());
+        percentile = std::min(percentile, static_cast<double>(*nth));
+        worst = std::min(worst, static_cast<double>(*std::max_element(nth, latencies.end())));
+        container = Container();
+        state.ResumeTiming();
+    }
+
+    state.counters["max_ns"] = worst;
+    state.counters["p999_ns"] = percentile;
+}
+
+template <typename Container>
+void RegisterPushLatencyBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_PushLatency<Container>)
+        ->RangeMultiplier(10)
+        ->Range(10000, 1000000)
+        ->Unit(benchmark::kMicrosecond);
+}
+
+template <typename Container>
+void RegisterGrowthBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_Growth<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kMicrosecond);
+}
+
+template <typename Container>
+void RegisterGrowthFrontBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_GrowthFront<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kMicrosecond);
+}
+
+int main(int argc, char** argv) {
+    RegisterGrowthBenchmark<std::vector<long long>>("BM_Vector_Growth_LongLong");
+    RegisterGrowthBenchmark<std::deque<long long>>("BM_Deque_Growth_LongLong");
+    RegisterGrowthBenchmark<ring_buffer<long long>>("BM_RingBuffer_Growth_LongLong");
+    RegisterGrowthBenchmark<chunked_ring_buffer<long long>>("BM_ChunkedRingBuffer_Growth_LongLong");
+    RegisterGrowthFrontBenchmark<ring_buffer<long long>>("BM_RingBuffer_GrowthFront_LongLong");
+
+    RegisterGrowthBenchmark<std::vector<std::string>>("BM_Vector_Growth_String");
+    RegisterGrowthBenchmark<std::deque<std::string>>("BM_Deque_Growth_String");
+    RegisterGrowthBenchmark<ring_buffer<std::string>>("BM_RingBuffer_Growth_String");
+    RegisterGrowthFrontBenchmark<ring_buffer<std::string>>("BM_RingBuffer_GrowthFront_String");
+
+    RegisterGrowthBenchmark<std::vector<std::unique_ptr<long long>>>("BM_Vector_Growth_UniquePtr");
+    RegisterGrowthBenchmark<std::deque<std::unique_ptr<long long>>>("BM_Deque_Growth_UniquePtr");
+    RegisterGrowthBenchmark<ring_buffer<std::unique_ptr<long long>>>("BM_RingBuffer_Growth_UniquePtr");
+    RegisterGrowthFrontBenchmark<ring_buffer<std::unique_ptr<long long>>>("BM_RingBuffer_GrowthFront_UniquePtr");
+
+    RegisterGrowthBenchmark<incremental_ring_buffer>("BM_IncrementalRingBuffer_Growth_LongLong");
+    RegisterPushLatencyBenchmark<std::vector<long long>>("BM_Vector_PushLatency");
+    RegisterPushLatencyBenchmark<std::deque<long long>>("BM_Deque_PushLatency");
+    RegisterPushLatencyBenchmark<ring_buffer<long long>>("BM_RingBuffer_PushLatency");
+    RegisterPushLatencyBenchmark<incremental_ring_buffer>("BM_IncrementalRingBuffer_PushLatency");
+    RegisterPushLatencyBenchmark<chunked_ring_buffer<long long>>("BM_ChunkedRingBuffer_PushLatency");
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
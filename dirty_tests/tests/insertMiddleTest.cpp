@@ -17,6 +17,17 @@ void BM_InsertMiddle(benchmark::State& state) {
     }
 }
 
+// Inserts at Percent of the size, so that the closer end of the container is near the insertion point.
+template <typename Container, int Percent>
+void BM_InsertAt(benchmark::State& state) {
+    const std::string test_value = "Some really longs string that does not get opimized";
+    Container container(state.range(0));
+
+    for (auto _ : state) {
+        container.insert(container.begin() + container.size() * Percent / 100, test_value);
+    }
+}
+
 
 
 
@@ -29,12 +40,28 @@ void RegisterBenchmark(const std::string& name) {
         ->Unit(benchmark::kNanosecond);
 }
 
+void RegisterInsertAtBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
 int main(int argc, char** argv) {
     // Register benchmarks for different container types
     RegisterBenchmark<std::vector<std::string>>("BM_Vector_InsertMiddle");
     RegisterBenchmark<std::deque<std::string>>("BM_Deque_InsertMiddle");
     RegisterBenchmark<ring_buffer<std::string>>("BM_RingBuffer_InsertMiddle");
 
+    RegisterInsertAtBenchmark("BM_Vector_InsertNearFront", BM_InsertAt<std::vector<std::string>, 10>);
+    RegisterInsertAtBenchmark("BM_Deque_InsertNearFront", BM_InsertAt<std::deque<std::string>, 10>);
+    RegisterInsertAtBenchmark("BM_RingBuffer_InsertNearFront", BM_InsertAt<ring_buffer<std::string>, 10>);
+
+    RegisterInsertAtBenchmark("BM_Vector_InsertNearBack", BM_InsertAt<std::vector<std::string>, 90>);
+    RegisterInsertAtBenchmark("BM_Deque_InsertNearBack", BM_InsertAt<std::deque<std::string>, 90>);
+    RegisterInsertAtBenchmark("BM_RingBuffer_InsertNearBack", BM_InsertAt<ring_buffer<std::string>, 90>);
+
     benchmark::Initialize(&argc, argv);
     benchmark::RunSpecifiedBenchmarks();
 
@@ -0,0 +1,48 @@
+#include "ring_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <deque>
+#include <string>
+#include <random>
+
+// Inserts at random positions and pops the back, so that the size stays constant. The positions are the same for every container.
+template <typename Container>
+void BM_InsertRandom(benchmark::State& state) {
+    const std::string test_value = "Some really longs string that does not get opimized";
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<size_t> distribution(0, size);
+    std::vector<size_t> positions(1024);
+    for (auto& position : positions) {
+        position = distribution(generator);
+    }
+
+    Container container(size);
+    size_t i = 0;
+
+    for (auto _ : state) {
+        container.insert(container.begin() + positions[i++ % positions.size()], test_value);
+        container.pop_back();
+    }
+}
+
+template <typename Container>
+void RegisterBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_InsertRandom<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+int main(int argc, char** argv) {
+    RegisterBenchmark<std::vector<std::string>>("BM_Vector_InsertRandom");
+    RegisterBenchmark<std::deque<std::string>>("BM_Deque_InsertRandom");
+    RegisterBenchmark<ring_buffer<std::string>>("BM_RingBuffer_InsertRandom");
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
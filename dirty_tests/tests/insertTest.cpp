@@ -27,6 +27,19 @@ void BM_InsertAtEnd(benchmark::State& state) {
     }
 }
 
+// Inserts a small range into the middle and erases as many elements from the end, so that the size stays constant.
+template <typename Container>
+void BM_InsertRange(benchmark::State& state) {
+    const std::vector<long long> source(16, 42);
+
+    Container container(state.range(0));
+
+    for (auto _ : state) {
+        container.insert(container.begin() + container.size() / 2, source.begin(), source.end());
+        container.erase(container.end() - source.size(), container.end());
+    }
+}
+
 template <typename Container>
 void RegisterInsertBeginBenchmark(const std::string& name) {
 
@@ -45,6 +58,15 @@ void RegisterInsertEndBenchmark(const std::string& name) {
         ->Unit(benchmark::kNanosecond);
 }
 
+template <typename Container>
+void RegisterInsertRangeBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_InsertRange<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
 template <typename Container>
 void RegisterBenchmark(const std::string& name) {
 
@@ -65,6 +87,10 @@ int main(int argc, char** argv) {
     RegisterInsertEndBenchmark<std::list<long long>>("BM_List_InsertAtEnd");
     RegisterInsertEndBenchmark<ring_buffer<long long>>("BM_RingBuffer_InsertAtEnd");
 
+    RegisterInsertRangeBenchmark<std::vector<long long>>("BM_Vector_InsertRange");
+    RegisterInsertRangeBenchmark<std::deque<long long>>("BM_Deque_InsertRange");
+    RegisterInsertRangeBenchmark<ring_buffer<long long>>("BM_RingBuffer_InsertRange");
+
     benchmark::Initialize(&argc, argv);
     benchmark::RunSpecifiedBenchmarks();
 
@@ -0,0 +1,99 @@
+#include "ring_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <iostream>
+
+using counted_ring_buffer = ring_buffer<long long, std::allocator<long long>, default_capacity_policy, default_growth_policy, grow_overflow_policy, counting_observer>;
+
+// Compares the buffer with the default observer against the counting_observer, which updates its counters on every modification.
+// The default observer is stored as an empty base, so the buffer keeps its layout: data pointer, capacity, size and tail index.
+static_assert(sizeof(ring_buffer<long long>) == sizeof(long long*) + 3 * sizeof(size_t), "null_observer must not take space");
+
+template <typename Container>
+void BM_PushBack(benchmark::State& state) {
+    const long long test_value = 652;
+
+    Container container(state.range(0));
+
+    for (auto _ : state) {
+        container.push_back(test_value);
+    }
+}
+
+// Keeps state.range(0) elements as a sliding window, so every push wraps around the end of memory once per capacity.
+template <typename Container>
+void BM_SlidingWindow(benchmark::State& state) {
+    const long long test_value = 652;
+
+    Container container(state.range(0));
+
+    for (auto _ : state) {
+        container.pop_front();
+        container.push_back(test_value);
+    }
+}
+
+// Inserts and erases an element a quarter into the buffer, shifting the elements in front of it both times.
+template <typename Container>
+void BM_MiddleInsertErase(benchmark::State& state) {
+    const long long test_value = 652;
+
+    Container container(state.range(0));
+    const auto position = state.range(0) / 4;
+
+    for (auto _ : state) {
+        container.insert(container.begin() + position, test_value);
+        container.erase(container.begin() + position);
+    }
+}
+
+// Checks that inserting nothing is not counted, and that an insert which relocates the buffer adds to relocated_bytes but not to insert_shift.
+bool checkInsertCounters() {
+    const long long test_value = 652;
+
+    counted_ring_buffer container(100);
+    container.shrink_to_fit();
+    container.observer().reset();
+
+    container.insert(container.begin() + 50, size_t(0), test_value);
+    const auto empty = container.observer().snapshot();
+    if (empty.end_inserts != 0 || empty.middle_inserts != 0 || empty.insert_shift != 0) {
+        return false;
+    }
+
+    container.insert(container.begin() + 50, test_value);
+    const auto relocated = container.observer().snapshot();
+    if (relocated.middle_inserts != 1 || relocated.insert_shift != 0 || relocated.reallocations != 1 || relocated.relocated_bytes != 100 * sizeof(long long)) {
+        return false;
+    }
+
+    container.insert(container.begin() + 10, test_value);
+    const auto shifted = container.observer().snapshot();
+    return shifted.middle_inserts == 2 && shifted.insert_shift == 10 && shifted.reallocations == 1;
+}
+
+void RegisterObserverBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+int main(int argc, char** argv) {
+    if (!checkInsertCounters()) {
+        std::cerr << "counting_observer miscounted inserts\n";
+        return 1;
+    }
+
+    RegisterObserverBenchmark("BM_RingBuffer_PushBack", BM_PushBack<ring_buffer<long long>>);
+    RegisterObserverBenchmark("BM_CountedRingBuffer_PushBack", BM_PushBack<counted_ring_buffer>);
+    RegisterObserverBenchmark("BM_RingBuffer_SlidingWindow", BM_SlidingWindow<ring_buffer<long long>>);
+    RegisterObserverBenchmark("BM_CountedRingBuffer_SlidingWindow", BM_SlidingWindow<counted_ring_buffer>);
+    RegisterObserverBenchmark("BM_RingBuffer_MiddleInsertErase", BM_MiddleInsertErase<ring_buffer<long long>>);
+    RegisterObserverBenchmark("BM_CountedRingBuffer_MiddleInsertErase", BM_MiddleInsertErase<counted_ring_buffer>);
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
@@ -1,44 +1,153 @@
 #include "ring_buffer.hpp"
+#include <algorithm>
 #include <vector>
 #include <benchmark/benchmark.h>
 #include <vector>
 #include <deque>
 #include <list>
+#include <string>
+
+// Pausing the timer to refill a container costs more than popping all of its elements with pop_back_n, so a batch of containers is refilled
+// while paused and popped in one timed window. Every container counts as an iteration. The batch holds about this many elements in total,
+// and at least 16 containers.
+const size_t batchElements = 1 << 18;
+
+// Refilling a batch takes far longer than popping it, so the batched benchmarks stop after less timed work than the default.
+const double batchMinTime = 0.01;
+
+size_t batchSize(size_t size) {
+    return std::max<size_t>(16, batchElements / size);
+}
+
+// Refills the popped containers to size elements while the timer is paused. A vector or ring buffer reuses the memory it kept, whereas constructing
+// new containers would allocate and fault in fresh pages for every batch.
+template <typename Container>
+void refillBatch(benchmark::State& state, std::vector<Container>& containers, size_t size) {
+    state.PauseTiming();
+    for (auto& container : containers)
+    {
+        container.resize(size);
+    }
+    benchmark::DoNotOptimize(containers.data());
+    state.ResumeTiming();
+}
 
 template <typename Container>
 void BM_PopBack(benchmark::State& state) {
 
     const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<Container> containers(batchSize(size), Container(size));
 
+    while (state.KeepRunningBatch(containers.size())) {
+        refillBatch(state, containers, size);
 
-    
-    for (auto _ : state) {
-        state.PauseTiming();
-        Container container(size);
-        state.ResumeTiming();
-        
-        for(auto i = 0; i < size -1; ++i)
+        for (auto& container : containers)
         {
-            container.pop_back();
+            for (size_t i = 0; i < size - 1; ++i)
+            {
+                container.pop_back();
+            }
         }
+        benchmark::ClobberMemory();
     }
 }
 
 template <typename Container>
 void BM_PopFront(benchmark::State& state) {
 
+    const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<Container> containers(batchSize(size), Container(size));
+
+    while (state.KeepRunningBatch(containers.size())) {
+        refillBatch(state, containers, size);
+
+        for (auto& container : containers)
+        {
+            for (size_t i = 0; i < size - 1; ++i)
+            {
+                container.pop_front();
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename Container>
+void BM_PopBackN(benchmark::State& state) {
+
+    const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<Container> containers(batchSize(size), Container(size));
+
+    while (state.KeepRunningBatch(containers.size())) {
+        refillBatch(state, containers, size);
+
+        for (auto& container : containers)
+        {
+            container.pop_back_n(size - 1);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename Container>
+void BM_PopFrontN(benchmark::State& state) {
+
+    const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<Container> containers(batchSize(size), Container(size));
+
+    while (state.KeepRunningBatch(containers.size())) {
+        refillBatch(state, containers, size);
+
+        for (auto& container : containers)
+        {
+            container.pop_front_n(size - 1);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+// Reads and removes every element one at a time.
+template <typename Container>
+void BM_ReadPopFront(benchmark::State& state) {
+
     const size_t size = static_cast<size_t>(state.range(0));
 
-    
     for (auto _ : state) {
         state.PauseTiming();
         Container container(size);
         state.ResumeTiming();
-        
-        for(auto i = 0; i < size - 1 ; ++i)
+
+        long long sum = 0;
+        while (!container.empty())
         {
+            sum += container.front();
             container.pop_front();
         }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// Reads and removes the elements one contiguous segment at a time.
+void BM_PeekConsume(benchmark::State& state) {
+
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        ring_buffer<long long> container(size);
+        state.ResumeTiming();
+
+        long long sum = 0;
+        while (!container.empty())
+        {
+            const auto segment = container.peek_contiguous();
+            for (auto value : segment)
+            {
+                sum += value;
+            }
+            container.consume(segment.size());
+        }
+        benchmark::DoNotOptimize(sum);
     }
 }
 
@@ -48,6 +157,7 @@ void RegisterBackBenchmark(const std::string& name) {
     benchmark::RegisterBenchmark(name.c_str(), BM_PopBack<Container>)
         ->RangeMultiplier(2)
         ->Range(10000, 100000)
+        ->MinTime(batchMinTime)
         ->Unit(benchmark::kNanosecond);
 }
 
@@ -55,6 +165,35 @@ template <typename Container>
 void RegisterFrontBenchmark(const std::string& name) {
 
     benchmark::RegisterBenchmark(name.c_str(), BM_PopFront<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->MinTime(batchMinTime)
+        ->Unit(benchmark::kNanosecond);
+}
+
+template <typename Container>
+void RegisterBackNBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_PopBackN<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->MinTime(batchMinTime)
+        ->Unit(benchmark::kNanosecond);
+}
+
+template <typename Container>
+void RegisterFrontNBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_PopFrontN<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->MinTime(batchMinTime)
+        ->Unit(benchmark::kNanosecond);
+}
+
+void RegisterConsumeBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
         ->RangeMultiplier(2)
         ->Range(10000, 100000)
         ->Unit(benchmark::kNanosecond);
@@ -70,6 +209,15 @@ int main(int argc, char** argv) {
     RegisterBackBenchmark<std::list<long long>>("BM_List_PopBack");
     RegisterBackBenchmark<ring_buffer<long long>>("BM_RingBuffer_PopBack");
 
+    RegisterFrontNBenchmark<ring_buffer<long long>>("BM_RingBuffer_PopFrontN");
+    RegisterFrontNBenchmark<ring_buffer<std::string>>("BM_RingBuffer_String_PopFrontN");
+    RegisterFrontBenchmark<ring_buffer<std::string>>("BM_RingBuffer_String_PopFront");
+    RegisterBackNBenchmark<ring_buffer<long long>>("BM_RingBuffer_PopBackN");
+
+    RegisterConsumeBenchmark("BM_Deque_ReadPopFront", BM_ReadPopFront<std::deque<long long>>);
+    RegisterConsumeBenchmark("BM_RingBuffer_ReadPopFront", BM_ReadPopFront<ring_buffer<long long>>);
+    RegisterConsumeBenchmark("BM_RingBuffer_PeekConsume", BM_PeekConsume);
+
     benchmark::Initialize(&argc, argv);
     benchmark::RunSpecifiedBenchmarks();
 
@@ -4,6 +4,7 @@
 #include <vector>
 #include <deque>
 #include <list>
+#include <new>
 
 template <typename Container>
 void BM_PushBack(benchmark::State& state) {
@@ -27,6 +28,110 @@ void BM_PushFront(benchmark::State& state) {
     }
 }
 
+// Keeps state.range(0) elements as a sliding window by dropping the oldest element before each push.
+template <typename Container>
+void BM_SlidingWindow(benchmark::State& state) {
+    const long long test_value = 652;
+
+    Container container(state.range(0));
+
+    for (auto _ : state) {
+        container.pop_front();
+        container.push_back(test_value);
+    }
+}
+
+// Same as BM_SlidingWindow, over a ring_span on memory owned by a std::vector.
+void BM_RingSpan_SlidingWindow(benchmark::State& state) {
+    const long long test_value = 652;
+
+    std::vector<long long> memory(state.range(0));
+    ring_span<long long> span(memory.data(), memory.size(), memory.size());
+
+    for (auto _ : state) {
+        span.pop_front();
+        span.push_back(test_value);
+    }
+}
+
+// Every push to the full span replaces the oldest element, like BM_PushBack for overwrite_ring_buffer.
+void BM_RingSpan_OverwritePushBack(benchmark::State& state) {
+    const long long test_value = 652;
+
+    std::vector<long long> memory(state.range(0));
+    ring_span<long long, default_capacity_policy, overwrite_overflow_policy> span(memory.data(), memory.size(), memory.size());
+
+    for (auto _ : state) {
+        span.push_back(test_value);
+    }
+}
+
+using overwrite_ring_buffer = ring_buffer<long long, std::allocator<long long>, default_capacity_policy, default_growth_policy, overwrite_overflow_policy>;
+
+template <typename Container>
+void appendBatch(Container& container, const std::vector<long long>& batch) {
+    container.insert(container.end(), batch.begin(), batch.end());
+}
+
+void appendBatch(ring_buffer<long long>& container, const std::vector<long long>& batch) {
+    container.append(batch.begin(), batch.end());
+}
+
+// Ingests batches of state.range(0) elements one element at a time.
+template <typename Container>
+void BM_PushBackBatch(benchmark::State& state) {
+    const std::vector<long long> batch(state.range(0), 652);
+
+    Container container;
+
+    for (auto _ : state) {
+        for (auto value : batch) {
+            container.push_back(value);
+        }
+        benchmark::ClobberMemory();
+        container.clear();
+    }
+}
+
+// Ingests batches of state.range(0) elements with a single bulk insert.
+template <typename Container>
+void BM_AppendBatch(benchmark::State& state) {
+    const std::vector<long long> batch(state.range(0), 652);
+
+    Container container;
+
+    for (auto _ : state) {
+        appendBatch(container, batch);
+        benchmark::ClobberMemory();
+        container.clear();
+    }
+}
+
+// Ingests batches of state.range(0) elements by constructing them directly in the buffer, as a parser writing into prepared memory does.
+void BM_PrepareCommitBatch(benchmark::State& state) {
+    const std::vector<long long> batch(state.range(0), 652);
+
+    ring_buffer<long long> container;
+
+    for (auto _ : state) {
+        auto slots = container.prepare(batch.size());
+        for (size_t i = 0; i < batch.size(); ++i) {
+            ::new (static_cast<void*>(slots.data() + i)) long long(batch[i]);
+        }
+        container.commit(batch.size());
+        benchmark::ClobberMemory();
+        container.clear();
+    }
+}
+
+void RegisterBatchBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(8)
+        ->Range(64, 32768)
+        ->Unit(benchmark::kNanosecond);
+}
+
 template <typename Container>
 void RegisterPushBackBenchmark(const std::string& name) {
 
@@ -45,16 +150,52 @@ void RegisterPushFrontBenchmark(const std::string& name) {
         ->Unit(benchmark::kNanosecond);
 }
 
+void RegisterSpanBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
+template <typename Container>
+void RegisterSlidingWindowBenchmark(const std::string& name) {
+
+    benchmark::RegisterBenchmark(name.c_str(), BM_SlidingWindow<Container>)
+        ->RangeMultiplier(2)
+        ->Range(10000, 100000)
+        ->Unit(benchmark::kNanosecond);
+}
+
 int main(int argc, char** argv) {
     // Register benchmarks for different container types
     RegisterPushFrontBenchmark<std::deque<long long>>("BM_Deque_PushFront");
     RegisterPushFrontBenchmark<std::list<long long>>("BM_List_PushFront");
     RegisterPushFrontBenchmark<ring_buffer<long long>>("BM_RingBuffer_PushFront");
+    RegisterPushFrontBenchmark<chunked_ring_buffer<long long>>("BM_ChunkedRingBuffer_PushFront");
 
     RegisterPushBackBenchmark<std::vector<long long>>("BM_Vector_PushBack");
     RegisterPushBackBenchmark<std::deque<long long>>("BM_Deque_PushBack");
     RegisterPushBackBenchmark<std::list<long long>>("BM_List_PushBack");
     RegisterPushBackBenchmark<ring_buffer<long long>>("BM_RingBuffer_PushBack");
+    RegisterPushBackBenchmark<chunked_ring_buffer<long long>>("BM_ChunkedRingBuffer_PushBack");
+
+    // The overwriting buffer is constructed full, so every push replaces the oldest element.
+    RegisterPushBackBenchmark<overwrite_ring_buffer>("BM_RingBuffer_OverwritePushBack");
+    RegisterSlidingWindowBenchmark<std::deque<long long>>("BM_Deque_SlidingWindow");
+    RegisterSlidingWindowBenchmark<ring_buffer<long long>>("BM_RingBuffer_SlidingWindow");
+    RegisterSlidingWindowBenchmark<chunked_ring_buffer<long long>>("BM_ChunkedRingBuffer_SlidingWindow");
+    RegisterSpanBenchmark("BM_RingSpan_SlidingWindow", BM_RingSpan_SlidingWindow);
+    RegisterSpanBenchmark("BM_RingSpan_OverwritePushBack", BM_RingSpan_OverwritePushBack);
+
+    RegisterBatchBenchmark("BM_Vector_PushBackBatch", BM_PushBackBatch<std::vector<long long>>);
+    RegisterBatchBenchmark("BM_Vector_AppendBatch", BM_AppendBatch<std::vector<long long>>);
+    RegisterBatchBenchmark("BM_Deque_PushBackBatch", BM_PushBackBatch<std::deque<long long>>);
+    RegisterBatchBenchmark("BM_Deque_AppendBatch", BM_AppendBatch<std::deque<long long>>);
+    RegisterBatchBenchmark("BM_RingBuffer_PushBackBatch", BM_PushBackBatch<ring_buffer<long long>>);
+    RegisterBatchBenchmark("BM_RingBuffer_AppendBatch", BM_AppendBatch<ring_buffer<long long>>);
+    RegisterBatchBenchmark("BM_ChunkedRingBuffer_PushBackBatch", BM_PushBackBatch<chunked_ring_buffer<long long>>);
+    RegisterBatchBenchmark("BM_RingBuffer_PrepareCommitBatch", BM_PrepareCommitBatch);
 
     benchmark::Initialize(&argc, argv);
     benchmark::RunSpecifiedBenchmarks();
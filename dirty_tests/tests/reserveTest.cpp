@@ -1,10 +1,12 @@
 #include <benchmark/benchmark.h>
 
 #include "ring_buffer.hpp"
+#include "wrapFixture.hpp"
 #include <vector>
 
 ring_buffer<size_t> small_buffer(1, 1);
 std::vector<size_t> small_vec(1, 1);
+ring_buffer<size_t, realloc_allocator<size_t>> small_realloc_buffer(1, 1);
 
 static void BM_reserve_small_buffer(benchmark::State& state)
 {
@@ -18,6 +20,42 @@ static void BM_reserve_small_buffer(benchmark::State& state)
     }
 }
 
+static void BM_reserve_small_realloc_buffer(benchmark::State& state)
+{
+    for(auto _ : state)
+    {
+        for(auto i = state.range(0) ; i < state.range(0) + 1000 ; i++)
+        {
+            if(i % 2 == 0)
+            small_realloc_buffer.reserve(i);
+        }
+    }
+}
+
+// Doubles the capacity of a full buffer whose elements wrap around the end of memory by a quarter of the size.
+template <typename Container>
+static void BM_reserve_wrapped(benchmark::State& state)
+{
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        Container buffer;
+        buffer.reserve(state.range(0));
+        for(auto i = 0 ; i < state.range(0) ; i++)
+        {
+            buffer.push_back(i);
+        }
+        rotateToBack(buffer, state.range(0) / 4);
+        state.ResumeTiming();
+
+        buffer.reserve(state.range(0) * 2);
+
+        state.PauseTiming();
+        buffer = Container();
+        state.ResumeTiming();
+    }
+}
+
 static void BM_reserve_small_vector(benchmark::State& state)
 {
     for(auto _ : state)
@@ -54,5 +92,8 @@ static void BM_reserve_small_vector(benchmark::State& state)
 
 BENCHMARK(BM_reserve_small_buffer)->Range(2048, 1 << 19);
 BENCHMARK(BM_reserve_small_vector)->Range(2048, 1 << 19);
+BENCHMARK(BM_reserve_small_realloc_buffer)->Range(2048, 1 << 19);
+BENCHMARK_TEMPLATE(BM_reserve_wrapped, ring_buffer<size_t>)->RangeMultiplier(4)->Range(1 << 15, 1 << 23)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_reserve_wrapped, ring_buffer<size_t, realloc_allocator<size_t>>)->RangeMultiplier(4)->Range(1 << 15, 1 << 23)->Unit(benchmark::kMicrosecond);
 // BENCHMARK(BM_reserve_medium_buffer)->Range(4096, 1 << 13);
 // BENCHMARK(BM_reserve_medium_vector)->Range(4096, 1 << 13);
\ No newline at end of file
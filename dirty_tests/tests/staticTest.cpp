@@ -0,0 +1,84 @@
+#include "ring_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <array>
+
+// Fixed-capacity ring over a std::array, as written by hand for a known bound. Elements are assigned to, never constructed or destroyed.
+template <typename T, size_t N>
+struct array_ring {
+    std::array<T, N> data;
+    size_t head = 0;
+    size_t count = 0;
+
+    void push_back(const T& value) {
+        data[(head + count) % N] = value;
+        ++count;
+    }
+
+    void pop_front() {
+        head = (head + 1) % N;
+        --count;
+    }
+};
+
+// Keeps N / 2 elements as a sliding window by dropping the oldest element before each push.
+template <typename Container, size_t N>
+void BM_StaticSlidingWindow(benchmark::State& state) {
+    const long long test_value = 652;
+
+    Container container;
+    for (size_t i = 0; i < N / 2; ++i) {
+        container.push_back(test_value);
+    }
+
+    for (auto _ : state) {
+        container.pop_front();
+        container.push_back(test_value);
+        benchmark::DoNotOptimize(container);
+    }
+}
+
+// Fills the container to N elements and drains it again, as a queue that runs at its bound.
+template <typename Container, size_t N>
+void BM_StaticFillDrain(benchmark::State& state) {
+    const long long test_value = 652;
+
+    Container container;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i) {
+            container.push_back(test_value);
+        }
+        benchmark::DoNotOptimize(container);
+        for (size_t i = 0; i < N; ++i) {
+            container.pop_front();
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+void RegisterStaticBenchmark(const std::string& name, void (*function)(benchmark::State&)) {
+
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->Unit(benchmark::kNanosecond);
+}
+
+int main(int argc, char** argv) {
+    RegisterStaticBenchmark("BM_RingBuffer_SlidingWindow/64", BM_StaticSlidingWindow<ring_buffer<long long>, 64>);
+    RegisterStaticBenchmark("BM_ArrayRing_SlidingWindow/64", BM_StaticSlidingWindow<array_ring<long long, 64>, 64>);
+    RegisterStaticBenchmark("BM_StaticRingBuffer_SlidingWindow/64", BM_StaticSlidingWindow<static_ring_buffer<long long, 64>, 64>);
+    RegisterStaticBenchmark("BM_ArrayRing_SlidingWindow/1000", BM_StaticSlidingWindow<array_ring<long long, 1000>, 1000>);
+    RegisterStaticBenchmark("BM_StaticRingBuffer_SlidingWindow/1000", BM_StaticSlidingWindow<static_ring_buffer<long long, 1000>, 1000>);
+
+    RegisterStaticBenchmark("BM_RingBuffer_FillDrain/64", BM_StaticFillDrain<ring_buffer<long long>, 64>);
+    RegisterStaticBenchmark("BM_ArrayRing_FillDrain/64", BM_StaticFillDrain<array_ring<long long, 64>, 64>);
+    RegisterStaticBenchmark("BM_StaticRingBuffer_FillDrain/64", BM_StaticFillDrain<static_ring_buffer<long long, 64>, 64>);
+    RegisterStaticBenchmark("BM_RingBuffer_FillDrain/1024", BM_StaticFillDrain<ring_buffer<long long>, 1024>);
+    RegisterStaticBenchmark("BM_ArrayRing_FillDrain/1024", BM_StaticFillDrain<array_ring<long long, 1024>, 1024>);
+    RegisterStaticBenchmark("BM_StaticRingBuffer_FillDrain/1024", BM_StaticFillDrain<static_ring_buffer<long long, 1024>, 1024>);
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+#ifndef WRAP_FIXTURE_HPP
+#define WRAP_FIXTURE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Setup shared by the benchmarks that measure ring buffers whose elements wrap around the end of their memory.
+
+// Moves the first count elements to the back, keeping their values and order. A ring buffer that starts at the beginning of its memory
+// then wraps after size() - count elements.
+template <typename Container>
+void rotateToBack(Container& container, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        auto value = std::move(container.front());
+        container.pop_front();
+        container.push_back(std::move(value));
+    }
+}
+
+// Rotating a ring buffer moves its first element along its memory, so it must be rotated relative to the capacity for half of the elements to end up
+// on each side of the end of memory. Rotating a buffer that is not full by half of its elements may leave them contiguous.
+template <typename Container>
+auto wrapDistance(const Container& container, int) -> decltype(container.capacity()) {
+    return container.capacity() - container.size() / 2;
+}
+
+// Containers without a capacity, such as std::deque, are rotated by half of their elements.
+template <typename Container>
+size_t wrapDistance(const Container& container, long) {
+    return container.size() / 2;
+}
+
+// Wraps a ring buffer in the middle of its elements. Expects the first element to be at the beginning of memory, as after construction or reserve().
+template <typename Container>
+void makeWrapped(Container& container) {
+    rotateToBack(container, wrapDistance(container, 0));
+}
+
+// A vector has no front to pop and its elements are contiguous anyway, so it is left as is.
+template <typename T, typename Allocator>
+void makeWrapped(std::vector<T, Allocator>&) {}
+
+#endif /*WRAP_FIXTURE_HPP*/